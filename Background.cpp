@@ -6,60 +6,85 @@
 //================================================================
 
 #include "Background.h"
+#include <cmath>
 
 // CONSTRUCTOR
-Background::Background() : offset{0} {}
+Background::Background() : offset{0}, from{0}, step{0} {}
 
 // UPDATE
 void Background::update(int playerSpeed) {
+    from = offset;
+    step = playerSpeed;
     offset -= playerSpeed;
     if(offset <= -BACKGROUND_OFFSET_RESET) {
         offset = 0;
     }
 }
 
-// DRAW
-void Background::draw(SDL_Plotter& g) {
-    // GRASS
-    for(int y = 0; y < COL; y++) {
-        for(int x = 0; x < ROW; x++) {
-            g.plotPixel(x, y, GRASS);
-        }
-    }
+// ROAD STRIP
 
-    // ROAD
-    for(int y = 0; y < COL; y++) {
-        for(int x = ROAD_START; x < ROAD_END; x++) {
-            g.plotPixel(x, y, ROAD);
-        }
-    }
+/*
+ * Description: Paint grass, road, boundaries and dashes for every row
+ * Return: void
+ * Pre-condition: g is ROW wide
+ * Post-condition: Row y dashed where y % DASH_PERIOD < DASH_LENGTH
+ */
+static void paintRoad(SDL_Plotter& g) {
+    int height = g.getRow();
 
-    // CENTER DASHED LINE
-    for(int y = 0; y < COL; y++) {
-        int adjustedY = (y + offset) % (DASH_LENGTH + GAP_LENGTH);
-        if(adjustedY < DASH_LENGTH) {
-            for(int i = -LANE_MARKER_WIDTH; i <= LANE_MARKER_WIDTH; i++) {
-                g.plotPixel(CENTER_LANE_X + i, y, ROAD_LINE);
-            }
-        }
-    }
+    // GRASS AND ROAD
+    g.fillRect(0, 0, ROAD_START, height, GRASS);
+    g.fillRect(ROAD_START, 0, ROAD_END - ROAD_START, height, ROAD);
+    g.fillRect(ROAD_END, 0, ROW - ROAD_END, height, GRASS);
 
-    // SIDE LANE MARKERS (DASHED)
-    for(int y = 0; y < COL; y++) {
-        int adjustedY = (y + offset) % (DASH_LENGTH + GAP_LENGTH);
-        if(adjustedY < DASH_LENGTH) {
-            for(int i = -1; i <= 1; i++) {
-                g.plotPixel(ROAD_START + SIDE_LANE_OFFSET + i, y, WHITE2);
-                g.plotPixel(ROAD_END - SIDE_LANE_OFFSET + i, y, WHITE2);
-            }
+    // DASHED LINES: CENTER AND SIDE LANE MARKERS
+    for(int y = 0; y < height; y++) {
+        if(y % DASH_PERIOD < DASH_LENGTH) {
+            g.hline(CENTER_LANE_X - LANE_MARKER_WIDTH, y, 2 * LANE_MARKER_WIDTH + 1, ROAD_LINE);
+            g.hline(ROAD_START + SIDE_LANE_OFFSET - 1, y, 3, WHITE2);
+            g.hline(ROAD_END - SIDE_LANE_OFFSET - 1, y, 3, WHITE2);
         }
     }
 
     // ROAD BOUNDARIES
-    for(int y = 0; y < COL; y++) {
-        for(int i = -LANE_MARKER_WIDTH; i <= LANE_MARKER_WIDTH; i++) {
-            g.plotPixel(ROAD_START + i, y, WHITE2);
-            g.plotPixel(ROAD_END + i, y, WHITE2);
+    g.fillRect(ROAD_START - LANE_MARKER_WIDTH, 0, 2 * LANE_MARKER_WIDTH + 1, height, WHITE2);
+    g.fillRect(ROAD_END - LANE_MARKER_WIDTH, 0, 2 * LANE_MARKER_WIDTH + 1, height, WHITE2);
+}
+
+/*
+ * Description: One dash period of road, built once
+ * Return: const Uint32* - DASH_PERIOD rows of ROW pixels
+ * Pre-condition: None
+ * Post-condition: Strip painted on first call, shared afterwards
+ */
+static const Uint32* roadStrip() {
+    static SDL_Plotter strip(DASH_PERIOD, ROW, false, PLOTTER_HEADLESS);
+    static const bool painted = (paintRoad(strip), true);
+    (void)painted;
+    return strip.getPixels();
+}
+
+// DRAW
+void Background::draw(DrawList& list, double alpha) const {
+    const Uint32* strip = roadStrip();
+
+    // Part way through the last scroll, wrapped the way update wraps it
+    int shown = offset;
+    if(alpha < 1.0) {
+        shown = from - (int)lround(step * alpha);
+        if(shown <= -BACKGROUND_OFFSET_RESET) {
+            shown = 0;
         }
     }
+
+    // Screen row y shows dashes where (y + shown) % DASH_PERIOD < DASH_LENGTH.
+    // Above row -shown that sum is negative, so its remainder is too and
+    // every row there is dashed, like strip row 0.
+    int top = min(-shown, COL);
+    if(top > 0) {
+        list.rows(LAYER_BACKGROUND, 0, top, strip, 1, 0);
+    }
+
+    // Below it the pattern repeats every DASH_PERIOD rows of the strip
+    list.rows(LAYER_BACKGROUND, top, COL - top, strip, DASH_PERIOD, top + shown);
 }
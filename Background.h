@@ -9,10 +9,14 @@
 #define Background_h
 
 #include "Const.h"
+#include "DrawList.h"
+#include "State.h"
 
 class Background {
 private:
     int offset;     // Current animation offset for dashed lines
+    int from;       // Offset before the last update
+    int step;       // Pixels scrolled by the last update
 
 public:
     /*
@@ -32,12 +36,13 @@ public:
     void update(int playerSpeed);
 
     /*
-     * Description: Draw grass, road, and animated lane markings
+     * Description: Record grass, road, and animated lane markings,
+     *              alpha of the way through the last update's scroll
      * Return: void
-     * Pre-condition: SDL_Plotter g is initialized
-     * Post-condition: Background rendered to screen
+     * Pre-condition: 0 <= alpha <= 1
+     * Post-condition: Road rows appended to list on LAYER_BACKGROUND
      */
-    void draw(SDL_Plotter& g);
+    void draw(DrawList& list, double alpha = 1.0) const;
 
     /*
      * Description: Get current animation offset
@@ -46,6 +51,23 @@ public:
      * Post-condition: No state change
      */
     int getOffset() const { return offset; }
+
+    /*
+     * Description: Append scroll offset to a snapshot
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: State encoded into w
+     */
+    void save(StateWriter& w) const { w.putInt(offset); }
+
+    /*
+     * Description: Restore scroll offset from a snapshot
+     * Return: void
+     * Pre-condition: r positioned at data written by save()
+     * Post-condition: State replaced, r advanced; drawn without scrolling
+     *                 until the next update
+     */
+    void load(StateReader& r) { offset = from = r.getInt(); step = 0; }
 };
 
 #endif /* Background_h */
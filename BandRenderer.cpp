@@ -0,0 +1,80 @@
+//================================================================
+// BandRenderer.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Band-Parallel Rendering Implementation
+// Description: Persistent workers drawing horizontal bands
+//================================================================
+
+#include "BandRenderer.h"
+
+BandRenderer::BandRenderer(int threads)
+    : draw{nullptr},
+      frame{0},
+      pending{0},
+      stopping{false}
+{
+    // Views are bound to a real frame by every render()
+    SDL_Plotter unbound(1, 1, false, PLOTTER_HEADLESS);
+    for(int i = 0; i < std::max(threads, 1); i++) {
+        bands.emplace_back(new SDL_Plotter(unbound, 0, 0));
+    }
+    for(int i = 1; i < (int)bands.size(); i++) {
+        workers.emplace_back(&BandRenderer::workLoop, this, i);
+    }
+}
+
+BandRenderer::~BandRenderer() {
+    {
+        std::lock_guard<std::mutex> lock(mut);
+        stopping = true;
+    }
+    start.notify_all();
+    for(std::thread& worker : workers) worker.join();
+}
+
+void BandRenderer::render(SDL_Plotter& g, const BandDraw& drawFrame) {
+    // Rows split evenly, top band first
+    int count = (int)bands.size();
+    for(int i = 0; i < count; i++) {
+        bands[i]->bindBand(g, g.getRow() * i / count, g.getRow() * (i + 1) / count);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mut);
+        draw = &drawFrame;
+        pending = count - 1;
+        frame++;
+    }
+    start.notify_all();
+
+    drawFrame(*bands[0]);
+
+    {
+        std::unique_lock<std::mutex> lock(mut);
+        done.wait(lock, [this]{ return pending == 0; });
+        draw = nullptr;
+    }
+    for(int i = 0; i < count; i++) g.mergeBand(*bands[i]);
+}
+
+void BandRenderer::workLoop(int band) {
+    long long seen = 0;
+
+    while(true) {
+        const BandDraw* job;
+        {
+            std::unique_lock<std::mutex> lock(mut);
+            start.wait(lock, [&]{ return stopping || frame != seen; });
+            if(stopping) return;
+            seen = frame;
+            job = draw;
+        }
+
+        (*job)(*bands[band]);
+
+        {
+            std::lock_guard<std::mutex> lock(mut);
+            if(--pending == 0) done.notify_one();
+        }
+    }
+}
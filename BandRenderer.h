@@ -0,0 +1,79 @@
+//================================================================
+// BandRenderer.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Band-Parallel Rendering
+// Description: Draws one frame from several threads, each clipped
+//              to its own horizontal band of the framebuffer
+//================================================================
+
+#ifndef BandRenderer_h
+#define BandRenderer_h
+
+#include "SDL_Plotter.h"
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Whole frame's drawing, run once per band against that band's view
+typedef std::function<void(SDL_Plotter&)> BandDraw;
+
+class BandRenderer {
+private:
+    std::vector<std::unique_ptr<SDL_Plotter>> bands;    // One view per band
+    std::vector<std::thread> workers;   // Bands 1.., band 0 is the caller's
+    std::mutex               mut;
+    std::condition_variable  start;     // New frame or stopping
+    std::condition_variable  done;      // Last worker finished its band
+    const BandDraw*          draw;      // This frame's drawing
+    long long                frame;     // Frames started, wakes workers
+    int                      pending;   // Workers still drawing this frame
+    bool                     stopping;  // Workers should exit
+
+    /*
+     * Description: Worker thread body
+     * Return: void
+     * Pre-condition: Started by the constructor, band >= 1
+     * Post-condition: Draws its band of every frame until stopping
+     */
+    void workLoop(int band);
+
+public:
+    /*
+     * Description: Start the persistent worker threads
+     * Return: None (constructor)
+     * Pre-condition: threads >= 1
+     * Post-condition: threads - 1 workers waiting for a frame
+     */
+    explicit BandRenderer(int threads);
+
+    /*
+     * Description: Stop and join the workers
+     * Return: None (destructor)
+     * Pre-condition: No render() in progress
+     * Post-condition: All worker threads exited
+     */
+    ~BandRenderer();
+
+    /*
+     * Description: Draw one frame, every band in parallel
+     * Return: void
+     * Pre-condition: drawFrame only reads shared state, so it is safe to
+     *                run on several threads at once
+     * Post-condition: Frame drawn into g, damage merged into g
+     */
+    void render(SDL_Plotter& g, const BandDraw& drawFrame);
+
+    /*
+     * Description: Get number of bands
+     * Return: int - threads drawing each frame, the caller included
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    int getBandCount() const { return (int)bands.size(); }
+};
+
+#endif /* BandRenderer_h */
@@ -0,0 +1,350 @@
+//================================================================
+// BatchEngine.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Batched Multi-Game Engine Implementation
+// Description: Game::tickPlaying split into passes over all races
+//================================================================
+
+#include "BatchEngine.h"
+#include "LaneRule.h"
+#include <algorithm>
+#include <cstdlib>
+
+// Collision reach of two cars, as Collision::circlesOverlap
+static const int CAR_REACH = SIZE / 2 + SIZE / 2;
+
+BatchEngine::BatchEngine(int races)
+    : count{races},
+      rngs(races), state(races), live(races),
+      playerX(races), playerY(races), playerSpeed(races),
+      bgOffset(races), score(races), multiplier(races),
+      carsPassed(races), obstaclesAvoided(races), frames(races),
+      cooldown(races), finalScore(races), hitAI(races), hitObstacle(races),
+      aiX(BATCH_AI_CARS * races), aiY(BATCH_AI_CARS * races),
+      aiSpeed(BATCH_AI_CARS * races), aiLane(BATCH_AI_CARS * races),
+      aiTimer(BATCH_AI_CARS * races), aiDelay(BATCH_AI_CARS * races),
+      aiChanging(BATCH_AI_CARS * races),
+      obsX(BATCH_OBSTACLES * races), obsY(BATCH_OBSTACLES * races),
+      carHits(races), coneHits(races)
+{
+    for(int k = 0; k < count; k++) {
+        reset(k, k);
+    }
+}
+
+void BatchEngine::reset(int k, uint64_t seed) {
+    // Same order of construction (and RNG draws) as Game::reset
+    rngs[k].setSeed(seed);
+    state[k] = STATE_PLAYING;
+    live[k] = 1;
+    playerX[k] = PLAYER_START_X;
+    playerY[k] = PLAYER_START_Y;
+    playerSpeed[k] = CAR_START_SPEED;
+    bgOffset[k] = 0;
+    score[k] = 0;
+    multiplier[k] = SPEED_MULTIPLIER_BASE;
+    carsPassed[k] = 0;
+    obstaclesAvoided[k] = 0;
+    frames[k] = 0;
+    cooldown[k] = 0;
+    finalScore[k] = 0;
+    hitAI[k] = 0;
+    hitObstacle[k] = 0;
+
+    for(int s = 0; s < BATCH_AI_CARS; s++) {
+        int i = s * count + k;
+        // TrafficStore::addCar replaces the start x with a random lane
+        aiLane[i] = rngs[k].nextInt(3);
+        aiX[i] = LANE_X[aiLane[i]];
+        aiY[i] = TRAFFIC_CAR_Y[s];
+        aiSpeed[i] = TRAFFIC_SPEEDS[s];
+        aiTimer[i] = 0;
+        aiDelay[i] = AI_LANE_CHANGE_DELAY;
+        aiChanging[i] = 0;
+    }
+    for(int s = 0; s < BATCH_OBSTACLES; s++) {
+        int i = s * count + k;
+        obsX[i] = LANE_X[s];
+        obsY[i] = TRAFFIC_CONE_Y[s];
+    }
+}
+
+// PASS KERNELS: one slot of every race at a time. The arrays never
+// overlap; __restrict says so and VECTORIZE turns the loops into SIMD code
+
+/*
+ * Description: Move one AI car slot down by its speed and advance its
+ *              lane timer, in live races only
+ * Return: void
+ * Pre-condition: Every array holds n entries
+ * Post-condition: Cars of live races moved
+ */
+VECTORIZE
+static void moveCarSlot(int n, const int* __restrict alive, int* __restrict y,
+                        const int* __restrict v, int* __restrict timer) {
+    for(int k = 0; k < n; k++) {
+        y[k] += v[k] * alive[k];
+        timer[k] += alive[k];
+    }
+}
+
+/*
+ * Description: Steer one AI car slot toward its target lane, in live
+ *              races only
+ * Return: void
+ * Pre-condition: Every array holds n entries
+ * Post-condition: x stepped toward the lane, changing set while short of it
+ */
+VECTORIZE
+static void steerCarSlot(int n, const int* __restrict alive, int* __restrict x,
+                         const int* __restrict lane, int* __restrict changing) {
+    for(int k = 0; k < n; k++) {
+        int target = lane[k] == LEFT_LANE ? LEFT_LANE_X
+                   : lane[k] == CENTER_LANE ? CENTER_LANE_X : RIGHT_LANE_X;
+        bool below = x[k] < target - LANE_CHANGE_THRESHOLD;
+        bool above = x[k] > target + LANE_CHANGE_THRESHOLD;
+        int nx = below ? x[k] + LANE_CHANGE_STEP
+               : above ? x[k] - LANE_CHANGE_STEP : target;
+        x[k] = alive[k] ? nx : x[k];
+        changing[k] = alive[k] ? (below || above) : changing[k];
+    }
+}
+
+/*
+ * Description: Move one cone slot down by the player's speed, in live
+ *              races only
+ * Return: void
+ * Pre-condition: Every array holds n entries
+ * Post-condition: Cones of live races moved
+ */
+VECTORIZE
+static void moveConeSlot(int n, const int* __restrict alive, int* __restrict y,
+                         const int* __restrict speed) {
+    for(int k = 0; k < n; k++) {
+        y[k] += speed[k] * alive[k];
+    }
+}
+
+/*
+ * Description: Test every race's player against one AI car slot, as
+ *              Collision::circlesOverlap; the float sqrt compare is exact
+ *              as a squared-distance compare at these magnitudes
+ * Return: void
+ * Pre-condition: Every array holds n entries
+ * Post-condition: hits[k] set if race k's player touches its car
+ */
+VECTORIZE
+static void hitCarSlot(int n, const int* __restrict px, const int* __restrict py,
+                       const int* __restrict x, const int* __restrict y,
+                       int* __restrict hits) {
+    for(int k = 0; k < n; k++) {
+        int dx = px[k] - x[k];
+        int dy = py[k] - y[k];
+        hits[k] |= dx * dx + dy * dy < CAR_REACH * CAR_REACH;
+    }
+}
+
+/*
+ * Description: Test every race's player against one cone slot, as
+ *              Collision::boxesOverlap
+ * Return: void
+ * Pre-condition: Every array holds n entries
+ * Post-condition: hits[k] set if race k's player touches its cone
+ */
+VECTORIZE
+static void hitConeSlot(int n, const int* __restrict px, const int* __restrict py,
+                        const int* __restrict x, const int* __restrict y,
+                        int* __restrict hits) {
+    for(int k = 0; k < n; k++) {
+        hits[k] |= (px[k] + SIZE / 2 > x[k] - OBSTACLE_SIZE / 2) &
+                   (px[k] - SIZE / 2 < x[k] + OBSTACLE_SIZE / 2) &
+                   (py[k] + SIZE / 2 > y[k] - OBSTACLE_SIZE / 2) &
+                   (py[k] - SIZE / 2 < y[k] + OBSTACLE_SIZE / 2);
+    }
+}
+
+bool BatchEngine::laneBlocked(int k, int i, int lane) const {
+    int laneX = LANE_X[lane];
+
+    for(int s = 0; s < BATCH_OBSTACLES; s++) {
+        int o = s * count + k;
+        if(std::abs(obsX[o] - laneX) <= OBSTACLE_SIZE / 2) {
+            if(obsY[o] > aiY[i] && obsY[o] - aiY[i] < AI_LANE_LOOKAHEAD) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void BatchEngine::decideLane(int k, int i) {
+    aiLane[i] = LaneRule::decide(aiLane[i], rngs[k], [&](int lane) {
+        return laneBlocked(k, i, lane);
+    });
+}
+
+int BatchEngine::step(const uint8_t* actions) {
+    const int n = count;
+    int* alive = live.data();
+    int* px = playerX.data();
+    int* speed = playerSpeed.data();
+    int playing = 0;
+
+    // INPUT: PlayerCar::move
+    for(int k = 0; k < n; k++) {
+        if(!alive[k]) continue;
+        playing++;
+        switch(actions[k]) {
+            case ACTION_LEFT:
+                if(px[k] > ROAD_START + SIZE / 2 + ROAD_BOUNDARY_OFFSET) px[k] -= speed[k];
+                break;
+            case ACTION_RIGHT:
+                if(px[k] < ROAD_END - SIZE / 2 - ROAD_BOUNDARY_OFFSET) px[k] += speed[k];
+                break;
+            case ACTION_ACCELERATE:
+                speed[k] = std::min(speed[k] + 1, MAX_SPEED);
+                break;
+            case ACTION_BRAKE:
+                speed[k] = std::max(speed[k] - 1, MIN_SPEED);
+                break;
+        }
+    }
+
+    // BACKGROUND AND TIME POINTS: Background::update, PointsManager::update
+    int* bg = bgOffset.data();
+    int* sc = score.data();
+    float* mul = multiplier.data();
+    for(int k = 0; k < n; k++) {
+        int off = bg[k] - speed[k] * alive[k];
+        bg[k] = off <= -BACKGROUND_OFFSET_RESET ? 0 : off;
+
+        float m = static_cast<float>(SPEED_MULTIPLIER_BASE + speed[k] * SPEED_MULTIPLIER_INCREMENT);
+        mul[k] = alive[k] ? m : mul[k];
+        int timePoints = static_cast<int>(static_cast<float>(
+                         POINTS_PER_FRAME_BASE + mul[k] * POINTS_PER_FRAME_MULTIPLIER));
+        sc[k] += timePoints > 0 ? timePoints * alive[k] : 0;
+    }
+
+    // AI CARS: TrafficStore::updateCars, one slot of every race at a time
+    for(int s = 0; s < BATCH_AI_CARS; s++) {
+        int* x = &aiX[s * n];
+        int* y = &aiY[s * n];
+        int* v = &aiSpeed[s * n];
+        int* lane = &aiLane[s * n];
+        int* timer = &aiTimer[s * n];
+        int* delay = &aiDelay[s * n];
+        int* changing = &aiChanging[s * n];
+
+        moveCarSlot(n, alive, y, v, timer);
+
+        // Decisions are rare and draw from the RNG: scalar
+        for(int k = 0; k < n; k++) {
+            if(alive[k] && !changing[k] && timer[k] >= delay[k]) {
+                timer[k] = 0;
+                decideLane(k, s * n + k);
+            }
+        }
+
+        steerCarSlot(n, alive, x, lane, changing);
+
+        for(int k = 0; k < n; k++) {
+            if(alive[k] && y[k] > COL + SIZE) {
+                Random& rng = rngs[k];
+                lane[k] = rng.nextInt(3);
+                x[k] = LANE_X[lane[k]];
+                y[k] = -SIZE - rng.nextInt(AI_SPAWN_Y_RANDOM_RANGE);
+                timer[k] = 0;
+
+                sc[k] += static_cast<int>(POINTS_CAR_PASS * mul[k]);
+                carsPassed[k]++;
+            }
+        }
+    }
+
+    // OBSTACLES: TrafficStore::updateCones, one slot of every race at a time
+    for(int s = 0; s < BATCH_OBSTACLES; s++) {
+        int* x = &obsX[s * n];
+        int* y = &obsY[s * n];
+
+        moveConeSlot(n, alive, y, speed);
+
+        for(int k = 0; k < n; k++) {
+            if(alive[k] && y[k] > COL + OBSTACLE_SIZE) {
+                Random& rng = rngs[k];
+                x[k] = ROAD_START + OBSTACLE_SPAWN_MIN_X_OFFSET +
+                       rng.nextInt(ROAD_WIDTH - OBSTACLE_SPAWN_MAX_X_OFFSET);
+                y[k] = -OBSTACLE_SIZE - rng.nextInt(OBSTACLE_SPAWN_Y_RANDOM_RANGE);
+
+                sc[k] += static_cast<int>(POINTS_OBSTACLE_AVOIDED * mul[k]);
+                obstaclesAvoided[k]++;
+            }
+        }
+    }
+
+    // COLLISIONS: Collision::checkAllCollisions. Every race is tested one
+    // slot at a time first, then the hits are applied race by race.
+    const int* py = playerY.data();
+    std::fill(carHits.begin(), carHits.end(), 0);
+    std::fill(coneHits.begin(), coneHits.end(), 0);
+    for(int s = 0; s < BATCH_AI_CARS; s++) {
+        hitCarSlot(n, px, py, &aiX[s * n], &aiY[s * n], carHits.data());
+    }
+    for(int s = 0; s < BATCH_OBSTACLES; s++) {
+        hitConeSlot(n, px, py, &obsX[s * n], &obsY[s * n], coneHits.data());
+    }
+    for(int k = 0; k < n; k++) {
+        if(!alive[k]) continue;
+
+        if(cooldown[k] <= 0) {
+            if(carHits[k] || coneHits[k]) {
+                speed[k] = std::min(std::max(speed[k] - COLLISION_SPEED_PENALTY, MIN_SPEED), MAX_SPEED);
+                finalScore[k] = std::max(0, sc[k] - COLLISION_POINTS_PENALTY);
+                hitAI[k] = carHits[k];
+                hitObstacle[k] = coneHits[k];
+                state[k] = STATE_GAME_OVER;
+            }
+        } else {
+            cooldown[k]--;
+        }
+
+        // Win is checked after collisions, so it wins a same-tick tie
+        if(sc[k] >= POINTS_PER_LAP * MAX_LAPS) {
+            finalScore[k] = sc[k];
+            state[k] = STATE_WIN;
+        }
+
+        frames[k]++;
+        alive[k] = state[k] == STATE_PLAYING;
+    }
+
+    return playing;
+}
+
+bool BatchEngine::matches(int k, const Game& game) const {
+    const PlayerCar& player = game.getPlayer();
+    const PointsManager& points = game.getPoints();
+    const TrafficStore& traffic = game.getTraffic();
+
+    if(game.getState() != getState(k)) return false;
+    if(player.getLoc().x != playerX[k] || player.getLoc().y != playerY[k]) return false;
+    if(player.getSpeed() != playerSpeed[k]) return false;
+    if(points.getScore() != score[k] || points.getSpeedMultiplier() != multiplier[k]) return false;
+    if(points.getCarsPassed() != carsPassed[k]) return false;
+    if(points.getObstaclesAvoided() != obstaclesAvoided[k]) return false;
+    if(game.getFrameCount() != frames[k]) return false;
+    if(game.getState() == STATE_GAME_OVER &&
+       (game.getHitAI() != getHitAI(k) || game.getHitObstacle() != getHitObstacle(k))) return false;
+
+    if(traffic.getCarCount() != BATCH_AI_CARS) return false;
+    for(int s = 0; s < BATCH_AI_CARS; s++) {
+        point p = traffic.getCarLoc(s);
+        if(p.x != aiX[s * count + k] || p.y != aiY[s * count + k]) return false;
+    }
+
+    if(traffic.getConeCount() != BATCH_OBSTACLES) return false;
+    for(int s = 0; s < BATCH_OBSTACLES; s++) {
+        point p = traffic.getConeLoc(s);
+        if(p.x != obsX[s * count + k] || p.y != obsY[s * count + k]) return false;
+    }
+    return true;
+}
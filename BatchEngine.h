@@ -0,0 +1,193 @@
+//================================================================
+// BatchEngine.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Batched Multi-Game Engine
+// Description: Steps many races at once with structure-of-arrays
+//              state, tick-for-tick identical to Game
+//================================================================
+
+#ifndef BatchEngine_h
+#define BatchEngine_h
+
+#include "Game.h"
+#include "RaceEnv.h"
+#include "Random.h"
+#include <cstdint>
+#include <vector>
+
+// Entity counts built by Game::reset
+const int BATCH_AI_CARS = TRAFFIC_AI_CARS;
+const int BATCH_OBSTACLES = TRAFFIC_OBSTACLES;
+
+class BatchEngine {
+private:
+    int count;                  // Number of races
+
+    // PER RACE
+    vector<Random>   rngs;      // Same stream Game would own
+    vector<uint8_t>  state;     // GameState
+    vector<int>      live;      // 1 while STATE_PLAYING, masks the passes
+    vector<int>      playerX;
+    vector<int>      playerY;
+    vector<int>      playerSpeed;
+    vector<int>      bgOffset;
+    vector<int>      score;
+    vector<float>    multiplier;
+    vector<int>      carsPassed;
+    vector<int>      obstaclesAvoided;
+    vector<int>      frames;
+    vector<int>      cooldown;
+    vector<int>      finalScore;    // Penalized score shown on game over
+    vector<uint8_t>  hitAI;
+    vector<uint8_t>  hitObstacle;
+
+    // PER AI CAR, slot-major: [slot * count + race]
+    vector<int>      aiX;
+    vector<int>      aiY;
+    vector<int>      aiSpeed;
+    vector<int>      aiLane;        // Target AILane
+    vector<int>      aiTimer;       // Ticks since last lane decision
+    vector<int>      aiDelay;
+    vector<int>      aiChanging;
+
+    // PER OBSTACLE, slot-major: [slot * count + race]
+    vector<int>      obsX;
+    vector<int>      obsY;
+
+    // COLLISION PASS scratch, per race
+    vector<int>      carHits;
+    vector<int>      coneHits;
+
+    /*
+     * Description: LaneRule decision for one car, lanes blocked by
+     *              laneBlocked
+     * Return: void
+     * Pre-condition: Car due for a decision, obstacles not yet moved
+     * Post-condition: aiLane updated, rngs[k] advanced
+     */
+    void decideLane(int k, int i);
+
+    /*
+     * Description: Check for a cone ahead of an AI car in a lane, as
+     *              LaneIndex::blockedAhead over the race's cones
+     * Return: bool - true if a cone sits ahead in the lane
+     * Pre-condition: i indexes an AI car of race k
+     * Post-condition: No state change
+     */
+    bool laneBlocked(int k, int i, int lane) const;
+
+public:
+    /*
+     * Description: Allocate storage for a fixed number of races
+     * Return: None (constructor)
+     * Pre-condition: races > 0
+     * Post-condition: All races reset with seeds 0..races-1
+     */
+    explicit BatchEngine(int races);
+
+    /*
+     * Description: Start race k as Game(seed) after pressing 'S'
+     * Return: void
+     * Pre-condition: 0 <= k < getCount()
+     * Post-condition: Race k in STATE_PLAYING at frame zero
+     */
+    void reset(int k, uint64_t seed);
+
+    /*
+     * Description: Apply one RaceAction per race and advance one tick
+     * Return: int - races that were still playing before the tick
+     * Pre-condition: actions holds getCount() RaceAction values
+     * Post-condition: Finished races are left untouched
+     */
+    int step(const uint8_t* actions);
+
+    /*
+     * Description: Compare race k against a Game driven the same way
+     * Return: bool - true if every simulated value agrees
+     * Pre-condition: game started with the same seed and inputs
+     * Post-condition: No state change
+     */
+    bool matches(int k, const Game& game) const;
+
+    /*
+     * Description: Get number of races
+     * Return: int - race count
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    int getCount() const { return count; }
+
+    /*
+     * Description: Get state of race k
+     * Return: GameState - STATE_PLAYING, STATE_GAME_OVER or STATE_WIN
+     * Pre-condition: 0 <= k < getCount()
+     * Post-condition: No state change
+     */
+    GameState getState(int k) const { return static_cast<GameState>(state[k]); }
+
+    /*
+     * Description: Check if race k is still running
+     * Return: bool - true while STATE_PLAYING
+     * Pre-condition: 0 <= k < getCount()
+     * Post-condition: No state change
+     */
+    bool isPlaying(int k) const { return live[k] != 0; }
+
+    /*
+     * Description: Get score of race k
+     * Return: int - score as PointsManager::getScore
+     * Pre-condition: 0 <= k < getCount()
+     * Post-condition: No state change
+     */
+    int getScore(int k) const { return score[k]; }
+
+    /*
+     * Description: Get score shown on race k's game over or win screen
+     * Return: int - final score, 0 while still playing
+     * Pre-condition: 0 <= k < getCount()
+     * Post-condition: No state change
+     */
+    int getFinalScore(int k) const { return finalScore[k]; }
+
+    /*
+     * Description: Get ticks race k spent racing
+     * Return: int - frame count
+     * Pre-condition: 0 <= k < getCount()
+     * Post-condition: No state change
+     */
+    int getFrameCount(int k) const { return frames[k]; }
+
+    /*
+     * Description: Get AI cars passed in race k
+     * Return: int - carsPassed count
+     * Pre-condition: 0 <= k < getCount()
+     * Post-condition: No state change
+     */
+    int getCarsPassed(int k) const { return carsPassed[k]; }
+
+    /*
+     * Description: Get obstacles avoided in race k
+     * Return: int - obstaclesAvoided count
+     * Pre-condition: 0 <= k < getCount()
+     * Post-condition: No state change
+     */
+    int getObstaclesAvoided(int k) const { return obstaclesAvoided[k]; }
+
+    /*
+     * Description: Check if race k ended on an AI car
+     * Return: bool - true if an AI car caused the game over
+     * Pre-condition: 0 <= k < getCount()
+     * Post-condition: No state change
+     */
+    bool getHitAI(int k) const { return hitAI[k] != 0; }
+
+    /*
+     * Description: Check if race k ended on an obstacle
+     * Return: bool - true if an obstacle caused the game over
+     * Pre-condition: 0 <= k < getCount()
+     * Post-condition: No state change
+     */
+    bool getHitObstacle(int k) const { return hitObstacle[k] != 0; }
+};
+
+#endif /* BatchEngine_h */
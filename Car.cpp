@@ -8,8 +8,8 @@
 #include "Car.h"
 #include "Utils.h"
 #include "Obstacle.h"
+#include "Sprite.h"
 #include <algorithm>
-#include <cstdlib>
 #include <cmath>
 #include <vector>
 
@@ -23,37 +23,53 @@ Car::Car(int x, int y, color carColor, int speed)
       _speed{speed}
 {}
 
-void Car::draw(SDL_Plotter& g) {
-    int wheelSize = _size / 5 + 2;
+/*
+ * Description: Car body and wheels, painted once per color and size
+ * Return: const Sprite& - size x size sprite
+ * Pre-condition: size > 0
+ * Post-condition: Sprite cached for the rest of the run
+ */
+static const Sprite& carSprite(color c, int size) {
+    static SpriteCache sprites;
+    uint64_t key = (uint64_t)(RED_SHIFT * c.R + GREEN_SHIFT * c.G + BLUE_SHIFT * c.B) << 32 | (uint32_t)size;
 
-    // BODY
-    drawRect(_loc.x - _size / 2, _loc.y - _size / 2, _size, _size, _color, g);
+    return sprites.get(key, size, size, [&](SDL_Plotter& g) {
+        int x = size / 2, y = size / 2;
+        int wheelSize = size / 5 + 2;
 
-    // WHEELS
-    drawRect(_loc.x - _size / 2, _loc.y - _size / 2, wheelSize, wheelSize, BLACK, g);
-    drawRect(_loc.x + _size / 2 - wheelSize, _loc.y - _size / 2, wheelSize, wheelSize, BLACK, g);
-    drawRect(_loc.x - _size / 2, _loc.y + _size / 2 - wheelSize, wheelSize, wheelSize, BLACK, g);
-    drawRect(_loc.x + _size / 2 - wheelSize, _loc.y + _size / 2 - wheelSize, wheelSize, wheelSize, BLACK, g);
-}
+        // BODY
+        drawRect(x - size / 2, y - size / 2, size, size, c, g);
 
-bool Car::isOffScreen() const {
-    return _loc.y > COL + _size;
+        // WHEELS
+        drawRect(x - size / 2, y - size / 2, wheelSize, wheelSize, BLACK, g);
+        drawRect(x + size / 2 - wheelSize, y - size / 2, wheelSize, wheelSize, BLACK, g);
+        drawRect(x - size / 2, y + size / 2 - wheelSize, wheelSize, wheelSize, BLACK, g);
+        drawRect(x + size / 2 - wheelSize, y + size / 2 - wheelSize, wheelSize, wheelSize, BLACK, g);
+    });
 }
 
-point Car::getLoc() const {
-    return _loc;
+void Car::draw(DrawList& list, DrawLayer layer) const {
+    drawAt(list, layer, _loc, _color, _size);
 }
 
-point Car::getPrvLoc() const {
-    return _prvLoc;
+void Car::drawAt(DrawList& list, DrawLayer layer, point loc, color carColor, int size) {
+    list.sprite(layer, carSprite(carColor, size), loc.x - size / 2, loc.y - size / 2);
 }
 
-int Car::getSize() const {
-    return _size;
+void Car::save(StateWriter& w) const {
+    w.putInt(_loc.x);
+    w.putInt(_loc.y);
+    w.putInt(_prvLoc.x);
+    w.putInt(_prvLoc.y);
+    w.putInt(_speed);
 }
 
-int Car::getSpeed() const {
-    return _speed;
+void Car::load(StateReader& r) {
+    _loc.x    = r.getInt();
+    _loc.y    = r.getInt();
+    _prvLoc.x = r.getInt();
+    _prvLoc.y = r.getInt();
+    _speed    = r.getInt();
 }
 
 // PLAYER CAR CLASS IMPLEMENTATION
@@ -94,10 +110,6 @@ void PlayerCar::move(char direction) {
     }
 }
 
-void PlayerCar::update(int bgOffset) {
-    (void)bgOffset; // no continuous movement; input handled in main loop
-}
-
 void PlayerCar::respawn() {
     _loc.x = PLAYER_START_X;
     _loc.y = PLAYER_START_Y;
@@ -109,132 +121,33 @@ void PlayerCar::setSpeed(int speed) {
     _speed = std::min(std::max(speed, MIN_SPEED), MAX_SPEED);
 }
 
-// AI CAR CLASS IMPLEMENTATION
-
-AICar::AICar(int startX, int startY, color carColor, int speed)
-    : Car(startX, startY, carColor, speed),
-      _targetLane{0},
-      _laneChangeTimer{0},
-      _laneChangeDelay{AI_LANE_CHANGE_DELAY},
-      _changingLane{false}
-{
-    initializeLanes();
-    _targetLane = static_cast<int>(selectRandomLane());
-    _loc.x = getLanePosition(static_cast<AILane>(_targetLane));
-}
-
-void AICar::initializeLanes() {
-    _leftLane   = LEFT_LANE_X;
-    _centerLane = CENTER_LANE_X;
-    _rightLane  = RIGHT_LANE_X;
-}
-
-int AICar::getLanePosition(AILane lane) {
-    switch(lane) {
-        case LEFT_LANE:   return _leftLane;
-        case CENTER_LANE: return _centerLane;
-        case RIGHT_LANE:  return _rightLane;
-        default:          return _centerLane;
-    }
-}
-
-AILane AICar::selectRandomLane() {
-    int random = std::rand() % 3;
-    return static_cast<AILane>(random);
+void PlayerCar::save(StateWriter& w) const {
+    Car::save(w);
+    w.putByte(static_cast<uint8_t>(_lastDirection));
 }
 
-void AICar::updateLaneChange() {
-    int target = getLanePosition(static_cast<AILane>(_targetLane));
-
-    if(_loc.x < target - LANE_CHANGE_THRESHOLD) {
-        _loc.x += LANE_CHANGE_STEP;
-        _changingLane = true;
-    }
-    else if(_loc.x > target + LANE_CHANGE_THRESHOLD) {
-        _loc.x -= LANE_CHANGE_STEP;
-        _changingLane = true;
-    }
-    else {
-        _loc.x = target;
-        _changingLane = false;
-    }
+void PlayerCar::load(StateReader& r) {
+    Car::load(r);
+    _lastDirection = static_cast<char>(r.getByte());
 }
 
-bool AICar::isLaneBlocked(AILane lane, const std::vector<Obstacle>& obstacles) const {
-    int laneX = const_cast<AICar*>(this)->getLanePosition(lane);
+// AI CAR HANDLE IMPLEMENTATION
 
-    for (const auto& obs : obstacles) {
-        point oLoc = obs.getLocation();
-        int   oSize = obs.getSize();
-
-        // Same lane horizontally?
-        if (std::abs(oLoc.x - laneX) <= oSize / 2) {
-            // Ahead of AI within danger distance
-            if (oLoc.y > _loc.y && oLoc.y - _loc.y < 150) {
-                return true;
-            }
-        }
-    }
-    return false;
-}
+AICar::AICar(TrafficStore& store, int startX, int startY, color carColor, int speed, Random& rng)
+    : _store{&store},
+      _index{store.addCar(startX, startY, carColor, speed, rng)}
+{}
 
-void AICar::update(int bgOffset, const std::vector<Obstacle>& obstacles) {
+void AICar::update(int bgOffset, const LaneIndex& lanes, Random& rng) {
     (void)bgOffset; // not used currently
 
-    _prvLoc.x = _loc.x;
-    _prvLoc.y = _loc.y;
-
-    _loc.y += _speed;
-    _laneChangeTimer++;
-
-    if(!_changingLane && _laneChangeTimer >= _laneChangeDelay) {
-        _laneChangeTimer = 0;
-
-        AILane currentLane = static_cast<AILane>(_targetLane);
-
-        bool currentBlocked = isLaneBlocked(currentLane, obstacles);
-        bool leftBlocked    = isLaneBlocked(LEFT_LANE,   obstacles);
-        bool centerBlocked  = isLaneBlocked(CENTER_LANE, obstacles);
-        bool rightBlocked   = isLaneBlocked(RIGHT_LANE,  obstacles);
-
-        if (currentBlocked) {
-            std::vector<AILane> candidates;
-            if (!leftBlocked)   candidates.push_back(LEFT_LANE);
-            if (!centerBlocked) candidates.push_back(CENTER_LANE);
-            if (!rightBlocked)  candidates.push_back(RIGHT_LANE);
-
-            if (!candidates.empty()) {
-                AILane newLane = candidates[std::rand() % candidates.size()];
-                _targetLane = static_cast<int>(newLane);
-            }
-        } else {
-            int decision = std::rand() % 100;
-            if (decision < AI_LANE_CHANGE_THRESHOLD) {
-                std::vector<AILane> candidates = { LEFT_LANE, CENTER_LANE, RIGHT_LANE };
-
-                candidates.erase(
-                    std::remove_if(candidates.begin(), candidates.end(),
-                                   [&](AILane l){
-                                       return l == currentLane || isLaneBlocked(l, obstacles);
-                                   }),
-                    candidates.end()
-                );
-
-                if (!candidates.empty()) {
-                    AILane newLane = candidates[std::rand() % candidates.size()];
-                    _targetLane = static_cast<int>(newLane);
-                }
-            }
-        }
-    }
+    _store->updateCar(_index, lanes, rng);
+}
 
-    updateLaneChange();
+void AICar::respawn(Random& rng) {
+    _store->respawnCar(_index, rng);
 }
 
-void AICar::respawn() {
-    _targetLane = static_cast<int>(selectRandomLane());
-    _loc.x = getLanePosition(static_cast<AILane>(_targetLane));
-    _loc.y = -_size - (std::rand() % AI_SPAWN_Y_RANDOM_RANGE);
-    _prvLoc = _loc;
-    _laneChangeTimer = 0;
+void AICar::draw(DrawList& list) const {
+    _store->drawCar(_index, list);
 }
@@ -2,7 +2,10 @@
 // Car.h
 // Author: Jody Spikes, Hailey Pieper, Ian Dudley
 // Title: Base Car Class
-// Description: Base Car class with PlayerCar and AiCar subclasses
+// Description: Base Car class with the PlayerCar subclass, and AICar,
+//              a handle on one car of a TrafficStore. Car holds the
+//              shared state only and has no virtual functions, so
+//              every call is static
 //================================================================
 
 #ifndef SRC_CAR_H_
@@ -10,6 +13,11 @@
 
 #include "SDL_Plotter.h"
 #include "Const.h"
+#include "DrawList.h"
+#include "LaneIndex.h"
+#include "Random.h"
+#include "State.h"
+#include "TrafficStore.h"
 #include <vector>
 
 class Obstacle;  // Forward declaration
@@ -34,28 +42,20 @@ public:
     Car(int x, int y, color carColor, int speed);
 
     /*
-     * Description: Virtual destructor for proper inheritance cleanup
-     * Return: None (destructor)
-     * Pre-condition: None
-     * Post-condition: Car resources properly deallocated
-     */
-    virtual ~Car() {}
-
-    /*
-     * Description: Pure virtual update - implemented by subclasses
+     * Description: Record car with body and wheels
      * Return: void
-     * Pre-condition: bgOffset is valid
-     * Post-condition: Car state updated per subclass logic
+     * Pre-condition: None
+     * Post-condition: Car sprite appended to list on layer
      */
-    virtual void update(int bgOffset) = 0;
+    void draw(DrawList& list, DrawLayer layer = LAYER_CARS) const;
 
     /*
-     * Description: Draw car with body and wheels to screen
+     * Description: Record a car body and wheels without a Car object
      * Return: void
-     * Pre-condition: SDL_Plotter g is initialized
-     * Post-condition: Car body and wheels rendered to screen
+     * Pre-condition: size > 0
+     * Post-condition: Car sprite centered on loc appended to list on layer
      */
-    virtual void draw(SDL_Plotter& g);
+    static void drawAt(DrawList& list, DrawLayer layer, point loc, color carColor, int size);
 
     /*
      * Description: Check if car moved below visible area
@@ -63,15 +63,7 @@ public:
      * Pre-condition: None
      * Post-condition: No state change
      */
-    virtual bool isOffScreen() const;
-
-    /*
-     * Description: Reposition car (implemented by subclasses)
-     * Return: void
-     * Pre-condition: None
-     * Post-condition: Car repositioned according to subclass rules
-     */
-    virtual void respawn() = 0;
+    bool isOffScreen() const { return _loc.y > COL + _size; }
 
     /*
      * Description: Get car location
@@ -79,7 +71,7 @@ public:
      * Pre-condition: None
      * Post-condition: No state change
      */
-    point getLoc() const;
+    point getLoc() const { return _loc; }
 
     /*
      * Description: Get car previous location
@@ -87,7 +79,7 @@ public:
      * Pre-condition: None
      * Post-condition: No state change
      */
-    point getPrvLoc() const;
+    point getPrvLoc() const { return _prvLoc; }
 
     /*
      * Description: Get car size
@@ -95,7 +87,15 @@ public:
      * Pre-condition: None
      * Post-condition: No state change
      */
-    int getSize() const;
+    int getSize() const { return _size; }
+
+    /*
+     * Description: Get car color
+     * Return: color - body color
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    color getColor() const { return _color; }
 
     /*
      * Description: Get car speed
@@ -103,12 +103,28 @@ public:
      * Pre-condition: None
      * Post-condition: No state change
      */
-    int getSpeed() const;
+    int getSpeed() const { return _speed; }
+
+    /*
+     * Description: Append position and speed to a snapshot
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: State encoded into w
+     */
+    void save(StateWriter& w) const;
+
+    /*
+     * Description: Restore position and speed from a snapshot
+     * Return: void
+     * Pre-condition: r positioned at data written by save()
+     * Post-condition: State replaced, r advanced
+     */
+    void load(StateReader& r);
 };
 
 // PLAYER CAR CLASS - KEYBOARD CONTROLLED
 
-class PlayerCar : public Car {
+class PlayerCar final : public Car {
 private:
     char _lastDirection;  // Last direction pressed (not used for continuous move)
 
@@ -135,7 +151,7 @@ public:
      * Pre-condition: bgOffset is valid (currently unused)
      * Post-condition: No position change; input handled externally
      */
-    void update(int bgOffset) override;
+    void update(int bgOffset) { (void)bgOffset; }
 
     /*
      * Description: Reposition player car at starting location
@@ -143,7 +159,7 @@ public:
      * Pre-condition: None
      * Post-condition: Car reset to start position and starting speed
      */
-    void respawn() override;
+    void respawn();
 
     /*
      * Description: Set car speed directly, clamped to min/max
@@ -152,92 +168,120 @@ public:
      * Post-condition: Car speed set within [MIN_SPEED, MAX_SPEED]
      */
     void setSpeed(int speed);
+
+    /*
+     * Description: Append player car state to a snapshot
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: State encoded into w
+     */
+    void save(StateWriter& w) const;
+
+    /*
+     * Description: Restore player car state from a snapshot
+     * Return: void
+     * Pre-condition: r positioned at data written by save()
+     * Post-condition: State replaced, r advanced
+     */
+    void load(StateReader& r);
 };
 
-// AI CAR CLASS - AUTONOMOUS LANE CHANGING
+// AI CAR HANDLE - ONE CAR OF A TRAFFIC STORE
 
-class AICar : public Car {
+class AICar final {
 private:
-    int  _targetLane;        // Lane index car is moving toward
-    int  _laneChangeTimer;   // Counter for lane change decisions
-    int  _laneChangeDelay;   // Frames between potential lane changes
-    bool _changingLane;      // Whether currently shifting between lanes
-    int  _leftLane;          // X position of left lane
-    int  _centerLane;        // X position of center lane
-    int  _rightLane;         // X position of right lane
+    TrafficStore* _store;    // Store holding the car's components
+    int           _index;    // The car's index in the store
+
+public:
+    /*
+     * Description: Refer to a car already in a store
+     * Return: None (constructor)
+     * Pre-condition: 0 <= index < store.getCarCount()
+     * Post-condition: Handle on that index; removing a car moves the
+     *                 store's last car into its index
+     */
+    AICar(TrafficStore& store, int index) : _store{&store}, _index{index} {}
 
     /*
-     * Description: Initialize lane x-positions for AI
+     * Description: Add an AI car to a store at position w/ color & speed
+     * Return: None (constructor)
+     * Pre-condition: startX, startY within valid bounds, rng is the game's
+     * Post-condition: AI car appended to store w/ random lane selected
+     */
+    AICar(TrafficStore& store, int startX, int startY, color carColor, int speed, Random& rng);
+
+    /*
+     * Description: Update AI car position and lane behavior with obstacle awareness
      * Return: void
-     * Pre-condition: Road lane constants are defined
-     * Post-condition: Lane x values stored in member variables
+     * Pre-condition: lanes built from this tick's obstacles, rng is the game's
+     * Post-condition: Car moved down, lane change logic evaluated and applied
      */
-    void initializeLanes();
+    void update(int bgOffset, const LaneIndex& lanes, Random& rng);
 
     /*
-     * Description: Get x-position of a given lane
-     * Return: int - x coordinate for specified lane
-     * Pre-condition: lane is valid AILane value
-     * Post-condition: No state change
+     * Description: Reposition AI car at top of screen w/ new random lane
+     * Return: void
+     * Pre-condition: rng is the game's
+     * Post-condition: Car repositioned at top with random lane and timer reset
      */
-    int getLanePosition(AILane lane);
+    void respawn(Random& rng);
 
     /*
-     * Description: Smoothly move AI car toward target lane x position
+     * Description: Record AI car with body and wheels
      * Return: void
-     * Pre-condition: _targetLane set to desired lane index
-     * Post-condition: _loc.x moved toward target, _changingLane updated
+     * Pre-condition: None
+     * Post-condition: Car sprite appended to list on LAYER_CARS
      */
-    void updateLaneChange();
+    void draw(DrawList& list) const;
 
     /*
-     * Description: Select a random lane enum (LEFT, CENTER, RIGHT)
-     * Return: AILane - randomly chosen lane
+     * Description: Check if car moved below visible area
+     * Return: bool - true if off screen, false otherwise
      * Pre-condition: None
      * Post-condition: No state change
      */
-    AILane selectRandomLane();
+    bool isOffScreen() const { return _store->isCarOffScreen(_index); }
 
     /*
-     * Description: Check if a lane has an obstacle ahead of the AI car
-     * Return: bool - true if lane is blocked, false otherwise
-     * Pre-condition: obstacles vector is valid
+     * Description: Get car location
+     * Return: point - current position
+     * Pre-condition: None
      * Post-condition: No state change
      */
-    bool isLaneBlocked(AILane lane, const std::vector<Obstacle>& obstacles) const;
+    point getLoc() const { return _store->getCarLoc(_index); }
 
-public:
     /*
-     * Description: Initialize AI car at position w/ color & speed
-     * Return: None (constructor)
-     * Pre-condition: startX, startY within valid bounds
-     * Post-condition: AI car created w/ random lane selected
+     * Description: Get car previous location
+     * Return: point - previous position
+     * Pre-condition: None
+     * Post-condition: No state change
      */
-    AICar(int startX, int startY, color carColor, int speed = CAR_START_SPEED);
+    point getPrvLoc() const { return _store->getCarPrvLoc(_index); }
 
     /*
-     * Description: Update AI car position and lane behavior with obstacle awareness
-     * Return: void
-     * Pre-condition: bgOffset and obstacles are valid
-     * Post-condition: Car moved down, lane change logic evaluated and applied
+     * Description: Get car size
+     * Return: int - size (width/height in pixels)
+     * Pre-condition: None
+     * Post-condition: No state change
      */
-    void update(int bgOffset, const std::vector<Obstacle>& obstacles);
+    int getSize() const { return _store->getCarSize(_index); }
 
     /*
-     * Description: Override base update to satisfy interface (unused)
-     * Return: void
-     * Pre-condition: bgOffset is valid
+     * Description: Get car speed
+     * Return: int - movement speed
+     * Pre-condition: None
      * Post-condition: No state change
      */
-    void update(int bgOffset) override { (void)bgOffset; }
+    int getSpeed() const { return _store->getCarSpeed(_index); }
 
     /*
-     * Description: Reposition AI car at top of screen w/ new random lane
-     * Return: void
+     * Description: Get the car's index in its store
+     * Return: int - index
      * Pre-condition: None
-     * Post-condition: Car repositioned at top with random lane and timer reset
+     * Post-condition: No state change
      */
-    void respawn() override;
+    int getIndex() const { return _index; }
 };
 
 #endif /* SRC_CAR_H_ */
@@ -9,10 +9,120 @@
 #define Collision_h
 
 #include "Car.h"
+#include "CollisionKernel.h"
 #include "Obstacle.h"
+#include "SpatialGrid.h"
+#include "TrafficStore.h"
+#include <algorithm>
+#include <cmath>
 
 class Collision {
+private:
+    /*
+     * Description: Times at which p + v * t lies strictly inside -reach..reach
+     * Return: bool - false if never
+     * Pre-condition: reach > 0
+     * Post-condition: enter < exit set, unbounded when v is zero
+     */
+    static bool axisWindow(double p, double v, double reach, double& enter, double& exit) {
+        if(v == 0) {
+            enter = -HUGE_VAL;
+            exit = HUGE_VAL;
+            return fabs(p) < reach;
+        }
+        double t0 = (-reach - p) / v, t1 = (reach - p) / v;
+        enter = min(t0, t1);
+        exit = max(t0, t1);
+        return true;
+    }
+
 public:
+    /*
+     * Description: Swept test of two boxes moving in straight lines over
+     *              one step, overlapping as Obstacle::collidesWith
+     * Return: bool - true if they overlap at some time in 0..1
+     * Pre-condition: Halves are the boxes' size / 2
+     * Post-condition: toi set to the first time of overlap on a hit
+     */
+    static bool sweepBoxes(point aFrom, point aTo, int aHalf,
+                           point bFrom, point bTo, int bHalf, float& toi) {
+        // B's frame: A starts at p and moves by v
+        double px = aFrom.x - bFrom.x, py = aFrom.y - bFrom.y;
+        double vx = (aTo.x - aFrom.x) - (bTo.x - bFrom.x);
+        double vy = (aTo.y - aFrom.y) - (bTo.y - bFrom.y);
+        double reach = aHalf + bHalf;
+
+        double xEnter, xExit, yEnter, yExit;
+        if(!axisWindow(px, vx, reach, xEnter, xExit)) return false;
+        if(!axisWindow(py, vy, reach, yEnter, yExit)) return false;
+
+        double enter = max(xEnter, yEnter), exit = min(xExit, yExit);
+        if(enter >= exit || enter >= 1 || exit <= 0) return false;
+        toi = static_cast<float>(max(enter, 0.0));
+        return true;
+    }
+
+    /*
+     * Description: Swept test of two circles moving in straight lines over
+     *              one step, overlapping as checkCarCollision
+     * Return: bool - true if they overlap at some time in 0..1
+     * Pre-condition: Radii are the cars' size / 2
+     * Post-condition: toi set to the first time of overlap on a hit
+     */
+    static bool sweepCircles(point aFrom, point aTo, int aRadius,
+                             point bFrom, point bTo, int bRadius, float& toi) {
+        double px = aFrom.x - bFrom.x, py = aFrom.y - bFrom.y;
+        double vx = (aTo.x - aFrom.x) - (bTo.x - bFrom.x);
+        double vy = (aTo.y - aFrom.y) - (bTo.y - bFrom.y);
+        double reach = aRadius + bRadius;
+
+        // |p + v t|^2 < reach^2 between the roots of a t^2 + b t + c
+        double a = vx * vx + vy * vy;
+        double b = 2 * (px * vx + py * vy);
+        double c = px * px + py * py - reach * reach;
+        if(c < 0) {
+            toi = 0;
+            return true;
+        }
+        double disc = b * b - 4 * a * c;
+        if(a == 0 || disc <= 0) return false;
+
+        double root = sqrt(disc);
+        double enter = (-b - root) / (2 * a), exit = (-b + root) / (2 * a);
+        if(enter >= 1 || exit <= 0) return false;
+        toi = static_cast<float>(max(enter, 0.0));
+        return true;
+    }
+
+    /*
+     * Description: Check two cars for overlap, each a circle of its
+     *              size / 2 around its center
+     * Return: bool - true if collision detected, false otherwise
+     * Pre-condition: Sizes > 0
+     * Post-condition: No state change
+     */
+    static bool circlesOverlap(point a, int aSize, point b, int bSize) {
+        // DISTANCE BETWEEN CETNERS
+        int dx = a.x - b.x;
+        int dy = a.y - b.y;
+        float distance = sqrt(dx * dx + dy * dy);
+
+        return distance < (aSize / 2 + bSize / 2);
+    }
+
+    /*
+     * Description: Check two boxes for overlap, as Obstacle::collidesWith
+     * Return: bool - true if collision detected, false otherwise
+     * Pre-condition: Sizes > 0
+     * Post-condition: No state change
+     */
+    static bool boxesOverlap(point a, int aSize, point b, int bSize) {
+        return a.x + aSize / 2 > b.x - bSize / 2 &&
+               a.x - aSize / 2 < b.x + bSize / 2 &&
+               a.y + aSize / 2 > b.y - bSize / 2 &&
+               a.y - aSize / 2 < b.y + bSize / 2;
+    }
+
     /*
      * Description: Check collision between player and AI car
      * Return: bool - true if collision detected, false otherwise
@@ -20,17 +130,31 @@ public:
      * Post-condition: No state change
      */
     static bool checkCarCollision(const Car& player, const AICar& ai) {
-        point playerLoc = player.getLoc();
-        point aiLoc = ai.getLoc();
-        int playerSize = player.getSize();
-        int aiSize = ai.getSize();
+        return circlesOverlap(player.getLoc(), player.getSize(), ai.getLoc(), ai.getSize());
+    }
 
-        // DISTANCE BETWEEN CETNERS
-        int dx = playerLoc.x - aiLoc.x;
-        int dy = playerLoc.y - aiLoc.y;
-        float distance = sqrt(dx * dx + dy * dy);
+    /*
+     * Description: Swept collision between a car and an AI car over the
+     *              last tick
+     * Return: bool - true if they touched at any time during the tick
+     * Pre-condition: from is where car was when the tick began
+     * Post-condition: toi set to the fraction of the tick at first contact
+     */
+    static bool sweepCarCollision(point from, const Car& car, const AICar& ai, float& toi) {
+        return sweepCircles(from, car.getLoc(), car.getSize() / 2,
+                            ai.getPrvLoc(), ai.getLoc(), ai.getSize() / 2, toi);
+    }
 
-        return distance < (playerSize / 2 + aiSize / 2);
+    /*
+     * Description: Swept collision between a car and an obstacle over the
+     *              last tick
+     * Return: bool - true if they touched at any time during the tick
+     * Pre-condition: from is where car was when the tick began
+     * Post-condition: toi set to the fraction of the tick at first contact
+     */
+    static bool sweepObstacleCollision(point from, const Car& car, const Obstacle& obstacle, float& toi) {
+        return sweepBoxes(from, car.getLoc(), car.getSize() / 2,
+                          obstacle.getPrvLoc(), obstacle.getLocation(), obstacle.getSize() / 2, toi);
     }
 
     /*
@@ -73,6 +197,182 @@ public:
             }
         }
     }
+
+    /*
+     * Description: Check a car against the AI cars near it
+     * Return: bool - true if it collides with any AI car but skip
+     * Pre-condition: carGrid holds every AI car at its index in aiCars
+     * Post-condition: No state change
+     */
+    static bool hitsAnyCar(const Car& car,
+                           const vector<AICar>& aiCars,
+                           const SpatialGrid& carGrid,
+                           int skip = -1) {
+        point loc = car.getLoc();
+        int half = car.getSize() / 2;
+        return carGrid.query(loc.x - half, loc.y - half, loc.x + half, loc.y + half,
+                             [&](int id) { return id != skip && checkCarCollision(car, aiCars[id]); });
+    }
+
+    /*
+     * Description: Check a car against the obstacles near it
+     * Return: bool - true if it collides with any active obstacle
+     * Pre-condition: obstacleGrid holds every active obstacle at its
+     *                index in obstacles
+     * Post-condition: No state change
+     */
+    static bool hitsAnyObstacle(const Car& car,
+                                const vector<Obstacle>& obstacles,
+                                const SpatialGrid& obstacleGrid) {
+        point loc = car.getLoc();
+        int half = car.getSize() / 2;
+        return obstacleGrid.query(loc.x - half, loc.y - half, loc.x + half, loc.y + half,
+                                  [&](int id) { return checkObstacleCollision(car, obstacles[id]); });
+    }
+
+    /*
+     * Description: Check all collisions, visiting only nearby entities
+     * Return: void
+     * Pre-condition: Grids are up to date with aiCars and obstacles
+     * Post-condition: hitAI and hitObstacle set as by the linear check
+     */
+    static void checkAllCollisions(const Car& player,
+                                   const vector<AICar>& aiCars,
+                                   const vector<Obstacle>& obstacles,
+                                   const SpatialGrid& carGrid,
+                                   const SpatialGrid& obstacleGrid,
+                                   bool& hitAI,
+                                   bool& hitObstacle) {
+        hitAI = hitsAnyCar(player, aiCars, carGrid);
+        hitObstacle = hitsAnyObstacle(player, obstacles, obstacleGrid);
+    }
+
+    /*
+     * Description: Swept check of all collisions over the last tick,
+     *              visiting only nearby entities
+     * Return: void
+     * Pre-condition: from is where player was when the tick began; grids
+     *                placed each entity with its half size plus its move
+     * Post-condition: hitAI and hitObstacle set, toi set to the earliest
+     *                 contact if either is
+     */
+    static void sweepAllCollisions(point from,
+                                   const Car& player,
+                                   const vector<AICar>& aiCars,
+                                   const vector<Obstacle>& obstacles,
+                                   const SpatialGrid& carGrid,
+                                   const SpatialGrid& obstacleGrid,
+                                   bool& hitAI,
+                                   bool& hitObstacle,
+                                   float& toi) {
+        point to = player.getLoc();
+        int half = player.getSize() / 2;
+        int left = min(from.x, to.x) - half, right = max(from.x, to.x) + half;
+        int top = min(from.y, to.y) - half, bottom = max(from.y, to.y) + half;
+
+        hitAI = false;
+        hitObstacle = false;
+        toi = 1;
+        carGrid.query(left, top, right, bottom, [&](int id) {
+            float t;
+            if(sweepCarCollision(from, player, aiCars[id], t)) {
+                hitAI = true;
+                toi = min(toi, t);
+            }
+            return false;
+        });
+        obstacleGrid.query(left, top, right, bottom, [&](int id) {
+            float t;
+            if(sweepObstacleCollision(from, player, obstacles[id], t)) {
+                hitObstacle = true;
+                toi = min(toi, t);
+            }
+            return false;
+        });
+    }
+
+    // TRAFFIC STORE: the same tests over component arrays. End-of-tick
+    // checks run the batch kernels straight over every entity, which beats
+    // refiling the grids; swept checks still go through the grids
+
+    /*
+     * Description: Check a car against every AI car in the store
+     * Return: bool - true if it collides with any AI car but skip
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    static bool hitsAnyCar(const Car& car, const TrafficStore& traffic, int skip = -1) {
+        point loc = car.getLoc();
+        return CollisionKernel::firstCircleHit(loc.x, loc.y, car.getSize(),
+                                               traffic.getCarXs(), traffic.getCarYs(),
+                                               traffic.getCarSizes(), traffic.getCarCount(),
+                                               skip) >= 0;
+    }
+
+    /*
+     * Description: Check a car against every cone in the store
+     * Return: bool - true if it collides with any cone
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    static bool hitsAnyObstacle(const Car& car, const TrafficStore& traffic) {
+        point loc = car.getLoc();
+        return CollisionKernel::firstBoxHit(loc.x, loc.y, car.getSize(),
+                                            traffic.getConeLefts(), traffic.getConeTops(),
+                                            traffic.getConeRights(), traffic.getConeBottoms(),
+                                            traffic.getConeCount()) >= 0;
+    }
+
+    /*
+     * Description: Check all collisions against a traffic store
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: hitAI and hitObstacle set as by the vector checks
+     */
+    static void checkAllCollisions(const Car& player, const TrafficStore& traffic,
+                                   bool& hitAI, bool& hitObstacle) {
+        hitAI = hitsAnyCar(player, traffic);
+        hitObstacle = hitsAnyObstacle(player, traffic);
+    }
+
+    /*
+     * Description: Swept check of all collisions against a traffic store
+     *              over the last tick
+     * Return: void
+     * Pre-condition: from is where player was when the tick began;
+     *                traffic.updateGrids called since traffic last moved
+     * Post-condition: hitAI and hitObstacle set, toi set to the earliest
+     *                 contact if either is
+     */
+    static void sweepAllCollisions(point from, const Car& player, const TrafficStore& traffic,
+                                   bool& hitAI, bool& hitObstacle, float& toi) {
+        point to = player.getLoc();
+        int half = player.getSize() / 2;
+        int left = min(from.x, to.x) - half, right = max(from.x, to.x) + half;
+        int top = min(from.y, to.y) - half, bottom = max(from.y, to.y) + half;
+
+        hitAI = false;
+        hitObstacle = false;
+        toi = 1;
+        traffic.getCarGrid().query(left, top, right, bottom, [&](int id) {
+            float t;
+            if(sweepCircles(from, to, half, traffic.getCarPrvLoc(id), traffic.getCarLoc(id),
+                            traffic.getCarSize(id) / 2, t)) {
+                hitAI = true;
+                toi = min(toi, t);
+            }
+            return false;
+        });
+        traffic.getConeGrid().query(left, top, right, bottom, [&](int id) {
+            float t;
+            if(sweepBoxes(from, to, half, traffic.getConePrvLoc(id), traffic.getConeLoc(id),
+                          traffic.getConeSize(id) / 2, t)) {
+                hitObstacle = true;
+                toi = min(toi, t);
+            }
+            return false;
+        });
+    }
 };
 
 #endif /* Collision_h */
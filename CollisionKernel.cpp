@@ -0,0 +1,183 @@
+//================================================================
+// CollisionKernel.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Batch Collision Kernels Implementation
+// Description: Scalar reference and AVX2 kernels with runtime dispatch
+//================================================================
+
+#include "CollisionKernel.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define COLLISION_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
+typedef int (*CircleKernel)(int x, int y, int size, const int* xs, const int* ys,
+                            const int* sizes, int n, int skip);
+typedef int (*BoxKernel)(int x, int y, int size, const int* lefts, const int* tops,
+                         const int* rights, const int* bottoms, int n);
+
+// SCALAR REFERENCE
+
+/*
+ * Description: Circle test one entity at a time from index first
+ * Return: int - index of the first hit, -1 if none
+ * Pre-condition: As CollisionKernel::firstCircleHit
+ * Post-condition: No state change
+ */
+static int circleScalarFrom(int first, int x, int y, int size, const int* xs, const int* ys,
+                            const int* sizes, int n, int skip) {
+    int half = size / 2;
+    for(int i = first; i < n; i++) {
+        // Squared distance against squared reach: the same answer as
+        // comparing sqrt(distance) while reach stays far below 2^11
+        int dx = x - xs[i];
+        int dy = y - ys[i];
+        int reach = half + sizes[i] / 2;
+        if(dx * dx + dy * dy < reach * reach && i != skip) return i;
+    }
+    return -1;
+}
+
+static int circleScalar(int x, int y, int size, const int* xs, const int* ys,
+                        const int* sizes, int n, int skip) {
+    return circleScalarFrom(0, x, y, size, xs, ys, sizes, n, skip);
+}
+
+/*
+ * Description: Box test one entity at a time from index first
+ * Return: int - index of the first hit, -1 if none
+ * Pre-condition: As CollisionKernel::firstBoxHit
+ * Post-condition: No state change
+ */
+static int boxScalarFrom(int first, int x, int y, int size, const int* lefts, const int* tops,
+                         const int* rights, const int* bottoms, int n) {
+    int left = x - size / 2, right = x + size / 2;
+    int top = y - size / 2, bottom = y + size / 2;
+    for(int i = first; i < n; i++) {
+        if(right > lefts[i] && left < rights[i] && bottom > tops[i] && top < bottoms[i]) return i;
+    }
+    return -1;
+}
+
+static int boxScalar(int x, int y, int size, const int* lefts, const int* tops,
+                     const int* rights, const int* bottoms, int n) {
+    return boxScalarFrom(0, x, y, size, lefts, tops, rights, bottoms, n);
+}
+
+// AVX2: eight entities per step, the rest through the scalar reference
+
+#ifdef COLLISION_X86_SIMD
+__attribute__((target("avx2")))
+static int circleAVX2(int x, int y, int size, const int* xs, const int* ys,
+                      const int* sizes, int n, int skip) {
+    const __m256i cx = _mm256_set1_epi32(x);
+    const __m256i cy = _mm256_set1_epi32(y);
+    const __m256i half = _mm256_set1_epi32(size / 2);
+    const __m256i skipped = _mm256_set1_epi32(skip);
+    const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+
+    int i = 0;
+    for(; i + 8 <= n; i += 8) {
+        __m256i dx = _mm256_sub_epi32(cx, _mm256_loadu_si256((const __m256i*)(xs + i)));
+        __m256i dy = _mm256_sub_epi32(cy, _mm256_loadu_si256((const __m256i*)(ys + i)));
+        // Sizes are positive, so a shift halves them as / 2 does
+        __m256i reach = _mm256_add_epi32(half, _mm256_srai_epi32(
+                        _mm256_loadu_si256((const __m256i*)(sizes + i)), 1));
+
+        __m256i d2 = _mm256_add_epi32(_mm256_mullo_epi32(dx, dx), _mm256_mullo_epi32(dy, dy));
+        __m256i hit = _mm256_cmpgt_epi32(_mm256_mullo_epi32(reach, reach), d2);
+        __m256i self = _mm256_cmpeq_epi32(_mm256_add_epi32(lanes, _mm256_set1_epi32(i)), skipped);
+        int bits = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_andnot_si256(self, hit)));
+        if(bits) return i + __builtin_ctz(bits);
+    }
+    return circleScalarFrom(i, x, y, size, xs, ys, sizes, n, skip);
+}
+
+__attribute__((target("avx2")))
+static int boxAVX2(int x, int y, int size, const int* lefts, const int* tops,
+                   const int* rights, const int* bottoms, int n) {
+    const __m256i left = _mm256_set1_epi32(x - size / 2);
+    const __m256i right = _mm256_set1_epi32(x + size / 2);
+    const __m256i top = _mm256_set1_epi32(y - size / 2);
+    const __m256i bottom = _mm256_set1_epi32(y + size / 2);
+
+    int i = 0;
+    for(; i + 8 <= n; i += 8) {
+        __m256i hit = _mm256_and_si256(
+            _mm256_and_si256(_mm256_cmpgt_epi32(right, _mm256_loadu_si256((const __m256i*)(lefts + i))),
+                             _mm256_cmpgt_epi32(_mm256_loadu_si256((const __m256i*)(rights + i)), left)),
+            _mm256_and_si256(_mm256_cmpgt_epi32(bottom, _mm256_loadu_si256((const __m256i*)(tops + i))),
+                             _mm256_cmpgt_epi32(_mm256_loadu_si256((const __m256i*)(bottoms + i)), top)));
+        int bits = _mm256_movemask_ps(_mm256_castsi256_ps(hit));
+        if(bits) return i + __builtin_ctz(bits);
+    }
+    return boxScalarFrom(i, x, y, size, lefts, tops, rights, bottoms, n);
+}
+#endif
+
+static const CircleKernel CIRCLE_KERNELS[] = {
+    circleScalar,
+#ifdef COLLISION_X86_SIMD
+    circleAVX2
+#else
+    circleScalar
+#endif
+};
+
+static const BoxKernel BOX_KERNELS[] = {
+    boxScalar,
+#ifdef COLLISION_X86_SIMD
+    boxAVX2
+#else
+    boxScalar
+#endif
+};
+
+// DISPATCH
+
+static bool kernelSupported(CollisionKernelType type) {
+#ifdef COLLISION_X86_SIMD
+    __builtin_cpu_init();
+    switch(type) {
+        case COLLISION_SCALAR: return true;
+        case COLLISION_AVX2:   return __builtin_cpu_supports("avx2");
+    }
+    return false;
+#else
+    return type == COLLISION_SCALAR;
+#endif
+}
+
+static CollisionKernelType bestKernel() {
+    if(kernelSupported(COLLISION_AVX2)) return COLLISION_AVX2;
+    return COLLISION_SCALAR;
+}
+
+static CollisionKernelType kernelType = bestKernel();
+static CircleKernel        circleKernel = CIRCLE_KERNELS[kernelType];
+static BoxKernel           boxKernel = BOX_KERNELS[kernelType];
+
+int CollisionKernel::firstCircleHit(int x, int y, int size,
+                                    const int* xs, const int* ys, const int* sizes,
+                                    int n, int skip) {
+    return circleKernel(x, y, size, xs, ys, sizes, n, skip);
+}
+
+int CollisionKernel::firstBoxHit(int x, int y, int size,
+                                 const int* lefts, const int* tops,
+                                 const int* rights, const int* bottoms, int n) {
+    return boxKernel(x, y, size, lefts, tops, rights, bottoms, n);
+}
+
+CollisionKernelType CollisionKernel::getType() {
+    return kernelType;
+}
+
+bool CollisionKernel::setType(CollisionKernelType type) {
+    if(!kernelSupported(type)) return false;
+    kernelType = type;
+    circleKernel = CIRCLE_KERNELS[type];
+    boxKernel = BOX_KERNELS[type];
+    return true;
+}
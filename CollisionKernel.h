@@ -0,0 +1,64 @@
+//================================================================
+// CollisionKernel.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Batch Collision Kernels
+// Description: One car tested against many entities held in packed
+//              arrays, eight at a time with AVX2 where the CPU has it;
+//              squared distances instead of sqrt, precomputed boxes
+//              instead of bounds worked out per pair
+//================================================================
+
+#ifndef CollisionKernel_h
+#define CollisionKernel_h
+
+// Narrowphase kernel, best supported one picked at startup
+enum CollisionKernelType {
+    COLLISION_SCALAR,       // Reference, one entity at a time
+    COLLISION_AVX2          // Eight entities per step
+};
+
+class CollisionKernel {
+public:
+    /*
+     * Description: Find the first circle overlapping a car, each circle
+     *              of its size / 2 around its center, as
+     *              Collision::circlesOverlap
+     * Return: int - index of the first hit, -1 if none
+     * Pre-condition: Arrays hold n entries, sizes > 0, centers less than
+     *                32768 apart on each axis
+     * Post-condition: No state change; every kernel gives the same index
+     */
+    static int firstCircleHit(int x, int y, int size,
+                              const int* xs, const int* ys, const int* sizes,
+                              int n, int skip = -1);
+
+    /*
+     * Description: Find the first box overlapping a car's box, as
+     *              Collision::boxesOverlap; boxes are packed as edges
+     * Return: int - index of the first hit, -1 if none
+     * Pre-condition: Arrays hold n entries; an empty box (left > right)
+     *                never hits
+     * Post-condition: No state change; every kernel gives the same index
+     */
+    static int firstBoxHit(int x, int y, int size,
+                           const int* lefts, const int* tops,
+                           const int* rights, const int* bottoms, int n);
+
+    /*
+     * Description: Get the kernel the batch tests run on
+     * Return: CollisionKernelType - current kernel
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    static CollisionKernelType getType();
+
+    /*
+     * Description: Switch kernels, for benchmarks and checks
+     * Return: bool - false if the CPU cannot run it
+     * Pre-condition: None
+     * Post-condition: Kernel switched if supported
+     */
+    static bool setType(CollisionKernelType type);
+};
+
+#endif /* CollisionKernel_h */
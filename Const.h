@@ -36,6 +36,12 @@ const int PLAYER_START_X = ROW / 2;
 const int PLAYER_START_Y = COL - 50;
 const int ROAD_BOUNDARY_OFFSET = 10;
 
+// TRAFFIC
+const int TRAFFIC_AI_CARS = 3;      // Traffic Game::reset builds
+const int TRAFFIC_OBSTACLES = 3;
+const int TRAFFIC_STRESS = 2000;    // Cars and cones each in stress runs
+const int TRAFFIC_MAX = 20000;      // Most of each a snapshot may hold
+
 // COLLISION
 const int COLLISION_COOLDOWN = 60;
 const int COLLISION_SPEED_PENALTY = 3;
@@ -53,6 +59,7 @@ const int POINTS_OBSTACLE_AVOIDED = 5;
 const int AI_LANE_CHANGE_DELAY = 120;
 const int AI_LANE_CHANGE_THRESHOLD = 30;
 const int AI_SPAWN_Y_RANDOM_RANGE = 200;
+const int AI_LANE_LOOKAHEAD = 150;      // Rows ahead an obstacle blocks a lane
 
 // ROAD CONSTRAINTS
 const int ROAD_START = ROW / 4;
@@ -63,6 +70,7 @@ const int ROAD_WIDTH = ROAD_END - ROAD_START;
 const int LEFT_LANE_X = ROAD_START + ROAD_WIDTH / 6;
 const int CENTER_LANE_X = ROW / 2;
 const int RIGHT_LANE_X = ROAD_END - ROAD_WIDTH / 6;
+const int LANE_X[3] = { LEFT_LANE_X, CENTER_LANE_X, RIGHT_LANE_X };  // By AILane
 
 // LANE CHANGE MOVEMENT
 const int LANE_CHANGE_STEP = 2;
@@ -71,8 +79,12 @@ const int LANE_CHANGE_THRESHOLD = 2;
 // RENDERING
 const int DASH_LENGTH = 30;
 const int GAP_LENGTH = 20;
+const int DASH_PERIOD = DASH_LENGTH + GAP_LENGTH;
 const int FPS_TARGET = 30;
-const int FRAME_DELAY_MS = 30;
+const int RENDER_FPS_TARGET = 60;
+const int FRAME_MS = 1000 / RENDER_FPS_TARGET;
+const int TICK_MS = 1000 / FPS_TARGET;
+const int MAX_CATCHUP_TICKS = 5;
 
 // BACKGROUND
 const int BACKGROUND_OFFSET_RESET = 50;
@@ -85,6 +97,11 @@ const int OBSTACLE_SPAWN_MAX_X_OFFSET = 100;
 const int OBSTACLE_SPAWN_Y_RANDOM_RANGE = 300;
 const int OBSTACLE_STRIPE_HEIGHT = 5;
 
+// SPATIAL GRID
+const int GRID_CELL_SIZE = 64;      // No smaller than the largest entity
+const int GRID_TOP = -768;          // Spawn rows above the screen; beyond the
+const int GRID_BOTTOM = COL + 128;  // grid entities share the edge cells
+
 // SCREENS
 const int SCROLL_RESET_VALUE = 300;
 const int TEXT_Y_SPACING = 40;
@@ -93,6 +110,7 @@ const int GAME_OVER_Y_SPACING = 35;
 // FONT SIZES
 const int FONT_LARGE_WIDTH = 30;
 const int FONT_SMALL_WIDTH = 15;
+const int FONT_SMALL_HEIGHT = 20;
 
 // BASIC COLORS
 const color WHITE2(255, 255, 255);
@@ -116,6 +134,13 @@ const color AI_BLUE(0, 100, 255);
 const color AI_GREEN(0, 255, 0);
 const color AI_YELLOW(255, 255, 0);
 
+// STARTING TRAFFIC, in Game::reset order; cars spawned past these cycle
+// through the same looks and speeds
+const color TRAFFIC_COLORS[TRAFFIC_AI_CARS] = { AI_BLUE, AI_GREEN, AI_YELLOW };
+const int TRAFFIC_SPEEDS[TRAFFIC_AI_CARS] = { 4, 3, 5 };
+const int TRAFFIC_CAR_Y[TRAFFIC_AI_CARS] = { -50, -150, -250 };
+const int TRAFFIC_CONE_Y[TRAFFIC_OBSTACLES] = { -100, -300, -500 };
+
 // SCREEN BACKGROUND COLORS
 const color BG_START(20, 40, 80);
 const color BG_INSTRUCTIONS(30, 30, 50);
@@ -0,0 +1,112 @@
+//================================================================
+// DrawList.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Retained Draw List Implementation
+// Description: Recording, culling and execution of draw commands
+//================================================================
+
+#include "DrawList.h"
+#include "Font.h"
+#include <algorithm>
+
+// RECORD
+
+DrawCommand& DrawList::add(DrawLayer layer, DrawKind kind, int x, int y, int w, int h) {
+    layers[layer].push_back((int)commands.size());
+    commands.emplace_back();
+    DrawCommand& cmd = commands.back();
+    cmd.kind = kind;
+    cmd.x = x;
+    cmd.y = y;
+    cmd.w = w;
+    cmd.h = h;
+    return cmd;
+}
+
+void DrawList::clear() {
+    commands.clear();
+    chars.clear();
+    for(std::vector<int>& layer : layers) layer.clear();
+}
+
+void DrawList::rect(DrawLayer layer, int x, int y, int width, int height, color c) {
+    add(layer, DRAW_RECT, x, y, width, height).c = c;
+}
+
+void DrawList::span(DrawLayer layer, int x, int y, int length, color c) {
+    add(layer, DRAW_SPAN, x, y, length, 1).c = c;
+}
+
+void DrawList::sprite(DrawLayer layer, const Sprite& s, int x, int y) {
+    add(layer, DRAW_SPRITE, x, y, s.getWidth(), s.getHeight()).sprite = &s;
+}
+
+void DrawList::text(DrawLayer layer, int x, int y, color c, const std::string& s, bool large, int flashTimer) {
+    // Strokes may spill past the last cell, never past one atlas glyph
+    int width = large ? FontRenderer::largeTextWidth(s) : FontRenderer::smallTextWidth(s);
+    DrawCommand& cmd = add(layer, DRAW_TEXT, x, y, width + GLYPH_MAX_WIDTH, GLYPH_MAX_ROWS);
+    cmd.c = c;
+    cmd.text = chars.size();
+    cmd.length = s.size();
+    cmd.large = large;
+    cmd.flashTimer = flashTimer;
+    chars.insert(chars.end(), s.begin(), s.end());
+}
+
+void DrawList::rows(DrawLayer layer, int y, int height, const Uint32* src, int period, int phase) {
+    // Always full width: the target's width is only known at execute
+    DrawCommand& cmd = add(layer, DRAW_ROWS, 0, y, 0, height);
+    cmd.rows = src;
+    cmd.period = period;
+    cmd.phase = phase;
+}
+
+// EXECUTE
+
+int DrawList::execute(SDL_Plotter& g) const {
+    const int top = g.getTop(), bottom = g.getBottom(), width = g.getCol();
+    int drawn = 0;
+
+    for(const std::vector<int>& layer : layers) {
+        for(int index : layer) {
+            const DrawCommand& cmd = commands[index];
+
+            // CULL: nothing of it lands in the rows or columns g covers
+            if(cmd.h <= 0 || cmd.y >= bottom || cmd.y + cmd.h <= top) continue;
+            if(cmd.kind != DRAW_ROWS && (cmd.w <= 0 || cmd.x >= width || cmd.x + cmd.w <= 0)) continue;
+            drawn++;
+
+            switch(cmd.kind) {
+                case DRAW_RECT:
+                    g.fillRect(cmd.x, cmd.y, cmd.w, cmd.h, cmd.c);
+                    break;
+                case DRAW_SPAN:
+                    g.hline(cmd.x, cmd.y, cmd.w, cmd.c);
+                    break;
+                case DRAW_SPRITE:
+                    cmd.sprite->draw(g, cmd.x, cmd.y);
+                    break;
+                case DRAW_TEXT:
+                    if(cmd.large) {
+                        FontRenderer::drawLargeChars(g, cmd.x, cmd.y, cmd.c, chars.data() + cmd.text, cmd.length, cmd.flashTimer);
+                    } else {
+                        FontRenderer::drawSmallChars(g, cmd.x, cmd.y, cmd.c, chars.data() + cmd.text, cmd.length, cmd.flashTimer);
+                    }
+                    break;
+                case DRAW_ROWS: {
+                    // Only the rows g covers, one copy per pass over the strip
+                    int first = std::max(cmd.y, top), last = std::min(cmd.y + cmd.h, bottom);
+                    int s = (cmd.phase + first - cmd.y) % cmd.period;
+                    for(int y = first; y < last; ) {
+                        int n = std::min(last - y, cmd.period - s);
+                        g.blitRows(y, n, cmd.rows + (size_t)s * width);
+                        y += n;
+                        s = 0;
+                    }
+                    break;
+                }
+            }
+        }
+    }
+    return drawn;
+}
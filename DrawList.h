@@ -0,0 +1,134 @@
+//================================================================
+// DrawList.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Retained Draw List
+// Description: Draw commands recorded by layer, culled against the
+//              target and executed in one back-to-front pass
+//================================================================
+
+#ifndef DrawList_h
+#define DrawList_h
+
+#include "SDL_Plotter.h"
+#include "Sprite.h"
+#include <string>
+#include <vector>
+
+// Draw order, back to front
+enum DrawLayer {
+    LAYER_BACKGROUND,
+    LAYER_OBSTACLES,
+    LAYER_CARS,
+    LAYER_PLAYER,
+    LAYER_HUD,
+    LAYER_COUNT
+};
+
+enum DrawKind {
+    DRAW_RECT,      // fillRect
+    DRAW_SPAN,      // hline
+    DRAW_SPRITE,    // Sprite::draw
+    DRAW_TEXT,      // FontRenderer::drawLarge / drawSmall
+    DRAW_ROWS       // blitRows, source rows repeating
+};
+
+// One recorded call; x, y, w, h bound every pixel it can write
+struct DrawCommand {
+    DrawKind      kind;
+    int           x, y, w, h;
+    color         c;            // Fill or ink
+    const Sprite* sprite;       // DRAW_SPRITE
+    const Uint32* rows;         // DRAW_ROWS: source rows, getCol() wide
+    int           period;       // DRAW_ROWS: source rows before repeating
+    int           phase;        // DRAW_ROWS: source row of row y, >= 0
+    size_t        text;         // DRAW_TEXT: start in the text arena
+    size_t        length;       // DRAW_TEXT: characters
+    bool          large;        // DRAW_TEXT: drawLarge, else drawSmall
+    int           flashTimer;   // DRAW_TEXT
+};
+
+class DrawList {
+private:
+    // Arenas: clear() empties them but keeps their storage
+    std::vector<DrawCommand> commands;
+    std::vector<char>        chars;                 // Text of every DRAW_TEXT
+    std::vector<int>         layers[LAYER_COUNT];   // Commands by layer, in recording order
+
+    /*
+     * Description: Store a command on a layer
+     * Return: DrawCommand& - the stored command, to fill in
+     * Pre-condition: layer < LAYER_COUNT
+     * Post-condition: Command queued after earlier ones on its layer
+     */
+    DrawCommand& add(DrawLayer layer, DrawKind kind, int x, int y, int w, int h);
+
+public:
+    /*
+     * Description: Forget the recorded frame
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: List empty, storage kept for the next frame
+     */
+    void clear();
+
+    /*
+     * Description: Record a filled rectangle
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Command recorded
+     */
+    void rect(DrawLayer layer, int x, int y, int width, int height, color c);
+
+    /*
+     * Description: Record a horizontal span
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Command recorded
+     */
+    void span(DrawLayer layer, int x, int y, int length, color c);
+
+    /*
+     * Description: Record a sprite with its top-left corner at x, y
+     * Return: void
+     * Pre-condition: s outlives the list's next execute
+     * Post-condition: Command recorded
+     */
+    void sprite(DrawLayer layer, const Sprite& s, int x, int y);
+
+    /*
+     * Description: Record a line of pixel font text
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Command recorded, text copied into the list
+     */
+    void text(DrawLayer layer, int x, int y, color c, const std::string& s, bool large, int flashTimer = 0);
+
+    /*
+     * Description: Record rows copied from a strip that repeats every
+     *              period rows, starting at strip row phase
+     * Return: void
+     * Pre-condition: src holds period rows as wide as the target
+     * Post-condition: Command recorded
+     */
+    void rows(DrawLayer layer, int y, int height, const Uint32* src, int period, int phase);
+
+    /*
+     * Description: Draw the recorded frame, layer by layer, skipping
+     *              commands outside the rows g may draw
+     * Return: int - commands drawn, the rest were culled
+     * Pre-condition: SDL_Plotter g is initialized
+     * Post-condition: Frame drawn into g; the list is unchanged, so it
+     *                 can be executed again or by several band threads
+     */
+    int execute(SDL_Plotter& g) const;
+
+    /*
+     * Description: Get number of recorded commands
+     * Return: int - command count
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    int size() const { return (int)commands.size(); }
+};
+
+#endif /* DrawList_h */
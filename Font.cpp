@@ -8,584 +8,698 @@
 #include "Font.h"
 #include <cctype>
 
+// GLYPH ATLAS
+namespace {
+
+// Ink of one glyph: bit i of rows[r] set where column i of row top + r is drawn
+struct Glyph {
+    int    top;
+    int    width;
+    int    height;
+    Uint32 rows[GLYPH_MAX_ROWS];
+};
+
+struct GlyphAtlas {
+    Glyph large[256];
+    Glyph small[256];
+};
+
+/*
+ * Description: Rasterize every character of one size through its strokes
+ * Return: void
+ * Pre-condition: scratch is a headless GLYPH_MAX_ROWS x GLYPH_MAX_WIDTH plotter
+ * Post-condition: glyphs[ch] holds the ink of character ch
+ */
+void rasterize(SDL_Plotter& scratch, Glyph* glyphs,
+               void (*stroke)(SDL_Plotter&, int, int, color, char)) {
+    const Uint32* pixels = scratch.getPixels();
+    const int pitch = scratch.getPitch();
+
+    for(int ch = 0; ch < 256; ch++) {
+        scratch.clear(color(0, 0, 0));
+        const Uint32 blank = pixels[0];
+        stroke(scratch, 0, 0, color(255, 255, 255), static_cast<char>(ch));
+
+        Glyph& glyph = glyphs[ch];
+        glyph.top = glyph.width = glyph.height = 0;
+        for(int y = 0; y < GLYPH_MAX_ROWS; y++) {
+            Uint32 mask = 0;
+            for(int x = 0; x < GLYPH_MAX_WIDTH; x++) {
+                if(pixels[y * pitch + x] != blank) mask |= 1u << x;
+            }
+            if(mask == 0) continue;
+            if(glyph.height == 0) glyph.top = y;
+            glyph.height = y - glyph.top + 1;
+            glyph.rows[y - glyph.top] = mask;
+            while(glyph.width < GLYPH_MAX_WIDTH && (mask >> glyph.width) != 0) glyph.width++;
+        }
+    }
+}
+
+/*
+ * Description: Glyphs of both sizes, rasterized on first use
+ * Return: const GlyphAtlas& - shared atlas
+ * Pre-condition: None
+ * Post-condition: Atlas built once per process
+ */
+const GlyphAtlas& atlas() {
+    static GlyphAtlas glyphs;
+    static const bool built = []() {
+        SDL_Plotter scratch(GLYPH_MAX_ROWS, GLYPH_MAX_WIDTH, false, PLOTTER_HEADLESS);
+        rasterize(scratch, glyphs.large, FontRenderer::strokeLarge);
+        rasterize(scratch, glyphs.small, FontRenderer::strokeSmall);
+        return true;
+    }();
+    (void)built;
+    return glyphs;
+}
+
+}
+
 // DRAW LARGE TEXT
 void FontRenderer::drawLarge(SDL_Plotter& g, int x, int y, color c, const std::string& text, int flashTimer) {
+    drawLargeChars(g, x, y, c, text.data(), text.size(), flashTimer);
+}
+
+void FontRenderer::drawLargeChars(SDL_Plotter& g, int x, int y, color c, const char* text, size_t length, int flashTimer) {
     const int letterWidth = 30;
+    const Glyph* glyphs = atlas().large;
 
-    for(size_t i = 0; i < text.size(); ++i) {
+    for(size_t i = 0; i < length; ++i) {
         char ch = toupper(text[i]);
         if(ch == ' ') { x += letterWidth / 8; continue; }
         int charX = x + i * letterWidth;
 
         if(flashTimer != 0 && flashTimer % 20 < 10) continue;
 
-        switch(ch) {
-            case 'A':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 20 + thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c); }
-                break;
-            case 'B':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 16; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int px = 0; px < 16; px++) g.plotPixel(charX + px, y + 20 + thick, c);
-                for(int px = 0; px < 16; px++) g.plotPixel(charX + px, y + 36 - thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 4; py < 22; py++) g.plotPixel(charX + 17 - thick, y + py, c);
-                for(int py = 20; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c); }
-                break;
-            case 'C':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 16; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int px = 0; px < 16; px++) g.plotPixel(charX + px, y + 36 - thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c); }
-                break;
-            case 'D':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 16; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int px = 0; px < 16; px++) g.plotPixel(charX + px, y + 36 - thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 15 - thick, y + py, c); }
-                break;
-            case 'E':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int px = 0; px < 10; px++) g.plotPixel(charX + px, y + 20 + thick, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 36 - thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c); }
-                break;
-            case 'F':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int px = 0; px < 10; px++) g.plotPixel(charX + px, y + 20 + thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c); }
-                break;
-            case 'G':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 16; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 36 - thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int px = 10; px < 18; px++) g.plotPixel(charX + px, y + 20 + thick, c);
-                for(int py = 20; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c); }
-                break;
-            case 'H':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 20 + thick, c); }
-                break;
-            case 'I':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 4; px < 14; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int px = 4; px < 14; px++) g.plotPixel(charX + px, y + 36 - thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 9 - thick, y + py, c); }
-                break;
-            case 'J':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 4; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 14, y + py, c);
-                for(int px = 0; px < 14; px++) g.plotPixel(charX + px, y + 36 - thick, c); }
-                break;
-            case 'K':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 4; py < 20; py++) g.plotPixel(charX + 17 - thick, y + py, c);
-                for(int py = 20; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 20 + thick, c); }
-                break;
-            case 'L':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 36 - thick, c); }
-                break;
-            case 'M':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int py = 4; py < 18; py++) g.plotPixel(charX + 8 + thick, y + py, c); }
-                break;
-            case 'N':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 2 + py / 2, y + py, c); }
-                break;
-            case 'O':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 36 - thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c); }
-                break;
-            case 'P':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 4; py < 22; py++) g.plotPixel(charX + 17 - thick, y + py, c);
-                for(int px = 6; px < 17; px++) g.plotPixel(charX + px, y + 20 + thick, c); }
-                break;
-            case 'Q':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 36 - thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 4; py < 32; py++) g.plotPixel(charX + 17 - thick, y + py, c);
-                for(int px = 12; px < 18; px++) g.plotPixel(charX + px, y + 32 + thick, c); }
-                break;
-            case 'R':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 4; py < 22; py++) g.plotPixel(charX + 17 - thick, y + py, c);
-                for(int px = 6; px < 17; px++) g.plotPixel(charX + px, y + 20 + thick, c);
-                for(int py = 20; py < 36; py++) g.plotPixel(charX + 12 + (py - 20) / 4 + thick / 2, y + py, c); }
-                break;
-            case 'S':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 16; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int px = 0; px < 16; px++) g.plotPixel(charX + px, y + 20 + thick, c);
-                for(int px = 4; px < 18; px++) g.plotPixel(charX + px, y + 36 - thick, c);
-                for(int py = 4; py < 20; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 20; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c); }
-                break;
-            case 'T':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 9 - thick, y + py, c); }
-                break;
-            case 'U':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 36 - thick, c); }
-                break;
-            case 'V':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int py = 4; py < 32; py++) g.plotPixel(charX + 0 + (py - 4) / 4 + thick, y + py, c);
-                for(int py = 4; py < 32; py++) g.plotPixel(charX + 17 - (py - 4) / 4 - thick, y + py, c); }
-                break;
-            case 'W':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c);
-                for(int i = 0; i < 10; i++) g.plotPixel(charX + 3 + i, y + 22 + i / 2, c);
-                for(int i = 0; i < 10; i++) g.plotPixel(charX + 14 - i, y + 22 + i / 2, c); }
-                break;
-            case 'X':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int py = 4; py < 36; py++) { int px = (py - 4) * 17 / 32 + thick; if(px >= 0 && px < 18) g.plotPixel(charX + px, y + py, c); }
-                for(int py = 4; py < 36; py++) { int px = 17 - (py - 4) * 17 / 32 + thick / 2; if(px >= 0 && px < 18) g.plotPixel(charX + px, y + py, c); } }
-                break;
-            case 'Y':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int py = 4; py < 16; py++) g.plotPixel(charX + 2 + thick, y + py, c);
-                for(int py = 4; py < 16; py++) g.plotPixel(charX + 16 - thick, y + py, c);
-                for(int py = 16; py < 36; py++) g.plotPixel(charX + 9 + thick / 2, y + py, c); }
-                break;
-            case 'Z':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 36 - thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 17 - (py - 4) / 4, y + py, c); }
-                break;
-            case ':':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 6; px < 12; px++) g.plotPixel(charX + px, y + 10 + thick, c);
-                for(int px = 6; px < 12; px++) g.plotPixel(charX + px, y + 26 + thick, c); }
-                break;
-            case '.':
-                for(int thick = 0; thick < 3; thick++)
-                for(int px = 6; px < 12; px++) g.plotPixel(charX + px, y + 32 + thick, c);
-                break;
-            case '!':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int py = 4; py < 30; py++) g.plotPixel(charX + 9 - thick, y + py, c);
-                for(int px = 6; px < 12; px++) g.plotPixel(charX + px, y + 34 + thick, c); }
-                break;
-            case '/':
-                for(int thick = 0; thick < 3; thick++)
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 17 - (py - 4) / 4, y + py, c);
-                break;
-            case '=':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 12 + thick, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 24 + thick, c); }
-                break;
-            case '0':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 36 - thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c); }
-                break;
-            case '1':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 8 + thick, y + py, c);
-                for(int px = 4; px < 12; px++) g.plotPixel(charX + px, y + 36 - thick, c); }
-                break;
-            case '2':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int py = 4; py < 20; py++) g.plotPixel(charX + 17 - thick, y + py, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 20 + thick, c);
-                for(int py = 20; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 36 - thick, c); }
-                break;
-            case '3':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 20 + thick, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 36 - thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c); }
-                break;
-            case '4':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int py = 4; py < 20; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 20 + thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c); }
-                break;
-            case '5':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int py = 4; py < 20; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 20 + thick, c);
-                for(int py = 20; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 36 - thick, c); }
-                break;
-            case '6':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 20 + thick, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 36 - thick, c);
-                for(int py = 20; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c); }
-                break;
-            case '7':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 17 - (py - 4) / 4, y + py, c); }
-                break;
-            case '8':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 20 + thick, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 36 - thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c); }
-                break;
-            case '9':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 20 + thick, c);
-                for(int py = 4; py < 22; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 36 - thick, c); }
-                break;
-            default:
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 2; px < 16; px++) g.plotPixel(charX + px, y + 8 + thick, c);
-                for(int px = 2; px < 16; px++) g.plotPixel(charX + px, y + 32 - thick, c);
-                for(int py = 8; py < 32; py++) g.plotPixel(charX + 2 + thick, y + py, c);
-                for(int py = 8; py < 32; py++) g.plotPixel(charX + 15 - thick, y + py, c); }
-                break;
-        }
+        const Glyph& glyph = glyphs[static_cast<unsigned char>(ch)];
+        g.blitMask(charX, y + glyph.top, glyph.width, glyph.height, glyph.rows, c);
     }
 }
 
 // DRAW SMALL TEXT
 void FontRenderer::drawSmall(SDL_Plotter& g, int x, int y, color c, const string& text, int flashTimer) {
+    drawSmallChars(g, x, y, c, text.data(), text.size(), flashTimer);
+}
+
+void FontRenderer::drawSmallChars(SDL_Plotter& g, int x, int y, color c, const char* text, size_t length, int flashTimer) {
     const int smallWidth = 15;
+    const Glyph* glyphs = atlas().small;
 
-    for(size_t i = 0; i < text.size(); ++i) {
+    for(size_t i = 0; i < length; ++i) {
         char ch = toupper(text[i]);
         if(ch == ' ') { x += smallWidth / 2; continue; }
         int charX = x + i * smallWidth;
 
         if(flashTimer != 0 && flashTimer % 30 < 15) continue;
 
-        switch(ch) {
-            case 'A':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 10 + thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 8 - thick, y + py, c); }
-                break;
-            case 'B':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 8; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int px = 0; px < 8; px++) g.plotPixel(charX + px, y + 10 + thick, c);
-                for(int px = 0; px < 8; px++) g.plotPixel(charX + px, y + 16 - thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 11; py++) g.plotPixel(charX + 7 - thick, y + py, c);
-                for(int py = 10; py < 18; py++) g.plotPixel(charX + 7 - thick, y + py, c); }
-                break;
-            case 'C':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 8; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int px = 0; px < 8; px++) g.plotPixel(charX + px, y + 16 - thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c); }
-                break;
-            case 'D':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 8; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int px = 0; px < 8; px++) g.plotPixel(charX + px, y + 16 - thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 7, y + py, c); }
-                break;
-            case 'E':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int px = 0; px < 5; px++) g.plotPixel(charX + px, y + 9 + thick, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 16 - thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c); }
-                break;
-            case 'F':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int px = 0; px < 5; px++) g.plotPixel(charX + px, y + 9 + thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c); }
-                break;
-            case 'G':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 8; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int px = 0; px < 8; px++) g.plotPixel(charX + px, y + 16 - thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int px = 5; px < 8; px++) g.plotPixel(charX + px, y + 9 + thick, c);
-                for(int py = 9; py < 18; py++) g.plotPixel(charX + 7 - thick, y + py, c); }
-                break;
-            case 'H':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 8 - thick, y + py, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 9 + thick, c); }
-                break;
-            case 'I':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 1; px < 8; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int px = 1; px < 8; px++) g.plotPixel(charX + px, y + 16 - thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 3 + thick, y + py, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 4, y + py, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 5 - thick, y + py, c); }
-                break;
-            case 'J':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 2; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 8 - thick, y + py, c);
-                for(int px = 0; px < 8; px++) g.plotPixel(charX + px, y + 16 - thick, c); }
-                break;
-            case 'K':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 10; py++) g.plotPixel(charX + 8 - (py - 2), y + py, c);
-                for(int py = 10; py < 18; py++) g.plotPixel(charX + 0 + (py - 10), y + py, c); }
-                break;
-            case 'L':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 16 - thick, c); }
-                break;
-            case 'M':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 8 - thick, y + py, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int py = 2; py < 10; py++) g.plotPixel(charX + 4 - thick, y + py, c); }
-                break;
-            case 'N':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 8 - thick, y + py, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 1 + (py - 2) / 2, y + py, c); }
-                break;
-            case 'O':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 16 - thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 8 - thick, y + py, c); }
-                break;
-            case 'P':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 11; py++) g.plotPixel(charX + 8 - thick, y + py, c);
-                for(int px = 3; px < 8; px++) g.plotPixel(charX + px, y + 10 + thick, c); }
-                break;
-            case 'Q':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 16 - thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 15; py++) g.plotPixel(charX + 8 - thick, y + py, c);
-                for(int px = 6; px < 9; px++) g.plotPixel(charX + px, y + 15 + thick, c); }
-                break;
-            case 'R':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 11; py++) g.plotPixel(charX + 8 - thick, y + py, c);
-                for(int px = 3; px < 8; px++) g.plotPixel(charX + px, y + 10 + thick, c);
-                for(int py = 10; py < 18; py++) g.plotPixel(charX + 6 + (py - 10) / 3, y + py, c); }
-                break;
-            case 'S':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 9 + thick, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 16 - thick, c);
-                for(int py = 2; py < 9; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 9; py < 18; py++) g.plotPixel(charX + 8 - thick, y + py, c);
-                for(int px = 0; px < 4; px++) g.plotPixel(charX + px, y + 8 + thick, c);
-                for(int px = 5; px < 9; px++) g.plotPixel(charX + px, y + 10 + thick, c); }
-                break;
-            case 'T':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 4 - thick, y + py, c); }
-                break;
-            case 'U':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 8 - thick, y + py, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 16 - thick, c); }
-                break;
-            case 'V':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int py = 2; py < 13; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 13; py++) g.plotPixel(charX + 8 - thick, y + py, c);
-                for(int py = 13; py < 18; py++) g.plotPixel(charX + 4 + (py - 13), y + py, c); }
-                break;
-            case 'W':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int py = 2; py < 16; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 16; py++) g.plotPixel(charX + 4 - thick, y + py, c);
-                for(int py = 2; py < 16; py++) g.plotPixel(charX + 8 - thick, y + py, c);
-                for(int py = 12; py < 18; py++) g.plotPixel(charX + 2 + thick, y + py, c);
-                for(int py = 12; py < 18; py++) g.plotPixel(charX + 6 - thick, y + py, c); }
-                break;
-            case 'X':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int py = 2; py < 18; py++) { int px = (py - 2) * 8 / 16 + thick; if(px >= 0 && px < 9) g.plotPixel(charX + px, y + py, c); }
-                for(int py = 2; py < 18; py++) { int px = 8 - (py - 2) * 8 / 16 + thick / 2; if(px >= 0 && px < 9) g.plotPixel(charX + px, y + py, c); } }
-                break;
-            case 'Y':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int py = 2; py < 9; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 9; py++) g.plotPixel(charX + 8 - thick, y + py, c);
-                for(int py = 9; py < 18; py++) g.plotPixel(charX + 4 - thick, y + py, c); }
-                break;
-            case 'Z':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 16 - thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 8 - (py - 2) / 2, y + py, c); }
-                break;
-            case ':':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 3; px < 6; px++) g.plotPixel(charX + px, y + 5 + thick, c);
-                for(int px = 3; px < 6; px++) g.plotPixel(charX + px, y + 13 + thick, c); }
-                break;
-            case '.':
-                for(int thick = 0; thick < 2; thick++)
-                for(int px = 3; px < 6; px++) g.plotPixel(charX + px, y + 15 + thick, c);
-                break;
-            case '!':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int py = 2; py < 13; py++) g.plotPixel(charX + 4 - thick, y + py, c);
-                for(int px = 3; px < 6; px++) g.plotPixel(charX + px, y + 14 + thick, c);
-                for(int px = 3; px < 6; px++) g.plotPixel(charX + px, y + 17, c); }
-                break;
-            case '/':
-                for(int thick = 0; thick < 2; thick++)
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 8 - (py - 2) / 2, y + py, c);
-                break;
-            case '=':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 6 + thick, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 12 + thick, c); }
-                break;
-            case '0':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 16 - thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 8 - thick, y + py, c); }
-                break;
-            case '1':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 1; px < 4; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int py = 2; py < 16; py++) g.plotPixel(charX + 4 - thick, y + py, c);
-                for(int px = 1; px < 8; px++) g.plotPixel(charX + px, y + 16 - thick, c); }
-                break;
-            case '2':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int py = 2; py < 9; py++) g.plotPixel(charX + 8 - thick, y + py, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 9 + thick, c);
-                for(int py = 9; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 16 - thick, c); }
-                break;
-            case '3':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 9 + thick, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 16 - thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 8 - thick, y + py, c); }
-                break;
-            case '4':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int py = 2; py < 10; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 9 + thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 8 - thick, y + py, c); }
-                break;
-            case '5':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int py = 2; py < 10; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 9 + thick, c);
-                for(int py = 9; py < 18; py++) g.plotPixel(charX + 8 - thick, y + py, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 16 - thick, c); }
-                break;
-            case '6':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 9 + thick, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 16 - thick, c);
-                for(int py = 9; py < 18; py++) g.plotPixel(charX + 8 - thick, y + py, c); }
-                break;
-            case '7':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 8 - (py - 2) / 2, y + py, c); }
-                break;
-            case '8':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 9 + thick, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 16 - thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 8 - thick, y + py, c); }
-                break;
-            case '9':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 9 + thick, c);
-                for(int py = 2; py < 11; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 8 - thick, y + py, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 16 - thick, c); }
-                break;
-            default:
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 1; px < 8; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int px = 1; px < 8; px++) g.plotPixel(charX + px, y + 16 - thick, c);
-                for(int py = 4; py < 16; py++) g.plotPixel(charX + 1 + thick, y + py, c);
-                for(int py = 4; py < 16; py++) g.plotPixel(charX + 7 - thick, y + py, c); }
-                break;
-        }
+        const Glyph& glyph = glyphs[static_cast<unsigned char>(ch)];
+        g.blitMask(charX, y + glyph.top, glyph.width, glyph.height, glyph.rows, c);
+    }
+}
+
+// LARGE GLYPH STROKES
+void FontRenderer::strokeLarge(SDL_Plotter& g, int charX, int y, color c, char ch) {
+    switch(ch) {
+        case 'A':
+            for(int thick = 0; thick < 3; thick++) {
+            g.hline(charX, y + 4 + thick, 18, c);
+            g.hline(charX, y + 20 + thick, 18, c);
+            g.vline(charX + 0 + thick, y + 4, 32, c);
+            g.vline(charX + 17 - thick, y + 4, 32, c); }
+            break;
+        case 'B':
+            for(int thick = 0; thick < 3; thick++) {
+            g.hline(charX, y + 4 + thick, 16, c);
+            g.hline(charX, y + 20 + thick, 16, c);
+            g.hline(charX, y + 36 - thick, 16, c);
+            g.vline(charX + 0 + thick, y + 4, 32, c);
+            g.vline(charX + 17 - thick, y + 4, 18, c);
+            g.vline(charX + 17 - thick, y + 20, 16, c); }
+            break;
+        case 'C':
+            for(int thick = 0; thick < 3; thick++) {
+            g.hline(charX, y + 4 + thick, 16, c);
+            g.hline(charX, y + 36 - thick, 16, c);
+            g.vline(charX + 0 + thick, y + 4, 32, c); }
+            break;
+        case 'D':
+            for(int thick = 0; thick < 3; thick++) {
+            g.hline(charX, y + 4 + thick, 16, c);
+            g.hline(charX, y + 36 - thick, 16, c);
+            g.vline(charX + 0 + thick, y + 4, 32, c);
+            g.vline(charX + 15 - thick, y + 4, 32, c); }
+            break;
+        case 'E':
+            for(int thick = 0; thick < 3; thick++) {
+            g.hline(charX, y + 4 + thick, 18, c);
+            g.hline(charX, y + 20 + thick, 10, c);
+            g.hline(charX, y + 36 - thick, 18, c);
+            g.vline(charX + 0 + thick, y + 4, 32, c); }
+            break;
+        case 'F':
+            for(int thick = 0; thick < 3; thick++) {
+            g.hline(charX, y + 4 + thick, 18, c);
+            g.hline(charX, y + 20 + thick, 10, c);
+            g.vline(charX + 0 + thick, y + 4, 32, c); }
+            break;
+        case 'G':
+            for(int thick = 0; thick < 3; thick++) {
+            g.hline(charX, y + 4 + thick, 16, c);
+            g.hline(charX, y + 36 - thick, 18, c);
+            g.vline(charX + 0 + thick, y + 4, 32, c);
+            g.hline(charX + 10, y + 20 + thick, 8, c);
+            g.vline(charX + 17 - thick, y + 20, 16, c); }
+            break;
+        case 'H':
+            for(int thick = 0; thick < 3; thick++) {
+            g.vline(charX + 0 + thick, y + 4, 32, c);
+            g.vline(charX + 17 - thick, y + 4, 32, c);
+            g.hline(charX, y + 20 + thick, 18, c); }
+            break;
+        case 'I':
+            for(int thick = 0; thick < 3; thick++) {
+            g.hline(charX + 4, y + 4 + thick, 10, c);
+            g.hline(charX + 4, y + 36 - thick, 10, c);
+            g.vline(charX + 9 - thick, y + 4, 32, c); }
+            break;
+        case 'J':
+            for(int thick = 0; thick < 3; thick++) {
+            g.hline(charX + 4, y + 4 + thick, 14, c);
+            g.vline(charX + 14, y + 4, 32, c);
+            g.hline(charX, y + 36 - thick, 14, c); }
+            break;
+        case 'K':
+            for(int thick = 0; thick < 3; thick++) {
+            g.vline(charX + 0 + thick, y + 4, 32, c);
+            g.vline(charX + 17 - thick, y + 4, 16, c);
+            g.vline(charX + 17 - thick, y + 20, 16, c);
+            g.hline(charX, y + 20 + thick, 18, c); }
+            break;
+        case 'L':
+            for(int thick = 0; thick < 3; thick++) {
+            g.vline(charX + 0 + thick, y + 4, 32, c);
+            g.hline(charX, y + 36 - thick, 18, c); }
+            break;
+        case 'M':
+            for(int thick = 0; thick < 3; thick++) {
+            g.vline(charX + 0 + thick, y + 4, 32, c);
+            g.vline(charX + 17 - thick, y + 4, 32, c);
+            g.hline(charX, y + 4 + thick, 18, c);
+            g.vline(charX + 8 + thick, y + 4, 14, c); }
+            break;
+        case 'N':
+            for(int thick = 0; thick < 3; thick++) {
+            g.vline(charX + 0 + thick, y + 4, 32, c);
+            g.vline(charX + 17 - thick, y + 4, 32, c);
+            for(int py = 4; py < 36; py++) g.plotPixel(charX + 2 + py / 2, y + py, c); }
+            break;
+        case 'O':
+            for(int thick = 0; thick < 3; thick++) {
+            g.hline(charX, y + 4 + thick, 18, c);
+            g.hline(charX, y + 36 - thick, 18, c);
+            g.vline(charX + 0 + thick, y + 4, 32, c);
+            g.vline(charX + 17 - thick, y + 4, 32, c); }
+            break;
+        case 'P':
+            for(int thick = 0; thick < 3; thick++) {
+            g.hline(charX, y + 4 + thick, 18, c);
+            g.vline(charX + 0 + thick, y + 4, 32, c);
+            g.vline(charX + 17 - thick, y + 4, 18, c);
+            g.hline(charX + 6, y + 20 + thick, 11, c); }
+            break;
+        case 'Q':
+            for(int thick = 0; thick < 3; thick++) {
+            g.hline(charX, y + 4 + thick, 18, c);
+            g.hline(charX, y + 36 - thick, 18, c);
+            g.vline(charX + 0 + thick, y + 4, 32, c);
+            g.vline(charX + 17 - thick, y + 4, 28, c);
+            g.hline(charX + 12, y + 32 + thick, 6, c); }
+            break;
+        case 'R':
+            for(int thick = 0; thick < 3; thick++) {
+            g.hline(charX, y + 4 + thick, 18, c);
+            g.vline(charX + 0 + thick, y + 4, 32, c);
+            g.vline(charX + 17 - thick, y + 4, 18, c);
+            g.hline(charX + 6, y + 20 + thick, 11, c);
+            for(int py = 20; py < 36; py++) g.plotPixel(charX + 12 + (py - 20) / 4 + thick / 2, y + py, c); }
+            break;
+        case 'S':
+            for(int thick = 0; thick < 3; thick++) {
+            g.hline(charX, y + 4 + thick, 16, c);
+            g.hline(charX, y + 20 + thick, 16, c);
+            g.hline(charX + 4, y + 36 - thick, 14, c);
+            g.vline(charX + 0 + thick, y + 4, 16, c);
+            g.vline(charX + 17 - thick, y + 20, 16, c); }
+            break;
+        case 'T':
+            for(int thick = 0; thick < 3; thick++) {
+            g.hline(charX, y + 4 + thick, 18, c);
+            g.vline(charX + 9 - thick, y + 4, 32, c); }
+            break;
+        case 'U':
+            for(int thick = 0; thick < 3; thick++) {
+            g.vline(charX + 0 + thick, y + 4, 32, c);
+            g.vline(charX + 17 - thick, y + 4, 32, c);
+            g.hline(charX, y + 36 - thick, 18, c); }
+            break;
+        case 'V':
+            for(int thick = 0; thick < 3; thick++) {
+            for(int py = 4; py < 32; py++) g.plotPixel(charX + 0 + (py - 4) / 4 + thick, y + py, c);
+            for(int py = 4; py < 32; py++) g.plotPixel(charX + 17 - (py - 4) / 4 - thick, y + py, c); }
+            break;
+        case 'W':
+            for(int thick = 0; thick < 3; thick++) {
+            g.vline(charX + 0 + thick, y + 4, 32, c);
+            g.vline(charX + 17 - thick, y + 4, 32, c);
+            for(int i = 0; i < 10; i++) g.plotPixel(charX + 3 + i, y + 22 + i / 2, c);
+            for(int i = 0; i < 10; i++) g.plotPixel(charX + 14 - i, y + 22 + i / 2, c); }
+            break;
+        case 'X':
+            for(int thick = 0; thick < 3; thick++) {
+            for(int py = 4; py < 36; py++) { int px = (py - 4) * 17 / 32 + thick; if(px >= 0 && px < 18) g.plotPixel(charX + px, y + py, c); }
+            for(int py = 4; py < 36; py++) { int px = 17 - (py - 4) * 17 / 32 + thick / 2; if(px >= 0 && px < 18) g.plotPixel(charX + px, y + py, c); } }
+            break;
+        case 'Y':
+            for(int thick = 0; thick < 3; thick++) {
+            g.vline(charX + 2 + thick, y + 4, 12, c);
+            g.vline(charX + 16 - thick, y + 4, 12, c);
+            g.vline(charX + 9 + thick / 2, y + 16, 20, c); }
+            break;
+        case 'Z':
+            for(int thick = 0; thick < 3; thick++) {
+            g.hline(charX, y + 4 + thick, 18, c);
+            g.hline(charX, y + 36 - thick, 18, c);
+            for(int py = 4; py < 36; py++) g.plotPixel(charX + 17 - (py - 4) / 4, y + py, c); }
+            break;
+        case ':':
+            for(int thick = 0; thick < 3; thick++) {
+            g.hline(charX + 6, y + 10 + thick, 6, c);
+            g.hline(charX + 6, y + 26 + thick, 6, c); }
+            break;
+        case '.':
+            for(int thick = 0; thick < 3; thick++)
+            g.hline(charX + 6, y + 32 + thick, 6, c);
+            break;
+        case '!':
+            for(int thick = 0; thick < 3; thick++) {
+            g.vline(charX + 9 - thick, y + 4, 26, c);
+            g.hline(charX + 6, y + 34 + thick, 6, c); }
+            break;
+        case '/':
+            for(int thick = 0; thick < 3; thick++)
+            for(int py = 4; py < 36; py++) g.plotPixel(charX + 17 - (py - 4) / 4, y + py, c);
+            break;
+        case '=':
+            for(int thick = 0; thick < 3; thick++) {
+            g.hline(charX, y + 12 + thick, 18, c);
+            g.hline(charX, y + 24 + thick, 18, c); }
+            break;
+        case '0':
+            for(int thick = 0; thick < 3; thick++) {
+            g.hline(charX, y + 4 + thick, 18, c);
+            g.hline(charX, y + 36 - thick, 18, c);
+            g.vline(charX + 0 + thick, y + 4, 32, c);
+            g.vline(charX + 17 - thick, y + 4, 32, c); }
+            break;
+        case '1':
+            for(int thick = 0; thick < 3; thick++) {
+            g.vline(charX + 8 + thick, y + 4, 32, c);
+            g.hline(charX + 4, y + 36 - thick, 8, c); }
+            break;
+        case '2':
+            for(int thick = 0; thick < 3; thick++) {
+            g.hline(charX, y + 4 + thick, 18, c);
+            g.vline(charX + 17 - thick, y + 4, 16, c);
+            g.hline(charX, y + 20 + thick, 18, c);
+            g.vline(charX + 0 + thick, y + 20, 16, c);
+            g.hline(charX, y + 36 - thick, 18, c); }
+            break;
+        case '3':
+            for(int thick = 0; thick < 3; thick++) {
+            g.hline(charX, y + 4 + thick, 18, c);
+            g.hline(charX, y + 20 + thick, 18, c);
+            g.hline(charX, y + 36 - thick, 18, c);
+            g.vline(charX + 17 - thick, y + 4, 32, c); }
+            break;
+        case '4':
+            for(int thick = 0; thick < 3; thick++) {
+            g.vline(charX + 0 + thick, y + 4, 16, c);
+            g.hline(charX, y + 20 + thick, 18, c);
+            g.vline(charX + 17 - thick, y + 4, 32, c); }
+            break;
+        case '5':
+            for(int thick = 0; thick < 3; thick++) {
+            g.hline(charX, y + 4 + thick, 18, c);
+            g.vline(charX + 0 + thick, y + 4, 16, c);
+            g.hline(charX, y + 20 + thick, 18, c);
+            g.vline(charX + 17 - thick, y + 20, 16, c);
+            g.hline(charX, y + 36 - thick, 18, c); }
+            break;
+        case '6':
+            for(int thick = 0; thick < 3; thick++) {
+            g.hline(charX, y + 4 + thick, 18, c);
+            g.vline(charX + 0 + thick, y + 4, 32, c);
+            g.hline(charX, y + 20 + thick, 18, c);
+            g.hline(charX, y + 36 - thick, 18, c);
+            g.vline(charX + 17 - thick, y + 20, 16, c); }
+            break;
+        case '7':
+            for(int thick = 0; thick < 3; thick++) {
+            g.hline(charX, y + 4 + thick, 18, c);
+            for(int py = 4; py < 36; py++) g.plotPixel(charX + 17 - (py - 4) / 4, y + py, c); }
+            break;
+        case '8':
+            for(int thick = 0; thick < 3; thick++) {
+            g.hline(charX, y + 4 + thick, 18, c);
+            g.hline(charX, y + 20 + thick, 18, c);
+            g.hline(charX, y + 36 - thick, 18, c);
+            g.vline(charX + 0 + thick, y + 4, 32, c);
+            g.vline(charX + 17 - thick, y + 4, 32, c); }
+            break;
+        case '9':
+            for(int thick = 0; thick < 3; thick++) {
+            g.hline(charX, y + 4 + thick, 18, c);
+            g.hline(charX, y + 20 + thick, 18, c);
+            g.vline(charX + 0 + thick, y + 4, 18, c);
+            g.vline(charX + 17 - thick, y + 4, 32, c);
+            g.hline(charX, y + 36 - thick, 18, c); }
+            break;
+        default:
+            for(int thick = 0; thick < 3; thick++) {
+            g.hline(charX + 2, y + 8 + thick, 14, c);
+            g.hline(charX + 2, y + 32 - thick, 14, c);
+            g.vline(charX + 2 + thick, y + 8, 24, c);
+            g.vline(charX + 15 - thick, y + 8, 24, c); }
+            break;
     }
 }
 
+// SMALL GLYPH STROKES
+void FontRenderer::strokeSmall(SDL_Plotter& g, int charX, int y, color c, char ch) {
+    switch(ch) {
+        case 'A':
+            for(int thick = 0; thick < 2; thick++) {
+            g.hline(charX, y + 2 + thick, 9, c);
+            g.hline(charX, y + 10 + thick, 9, c);
+            g.vline(charX + 0 + thick, y + 2, 16, c);
+            g.vline(charX + 8 - thick, y + 2, 16, c); }
+            break;
+        case 'B':
+            for(int thick = 0; thick < 2; thick++) {
+            g.hline(charX, y + 2 + thick, 8, c);
+            g.hline(charX, y + 10 + thick, 8, c);
+            g.hline(charX, y + 16 - thick, 8, c);
+            g.vline(charX + 0 + thick, y + 2, 16, c);
+            g.vline(charX + 7 - thick, y + 2, 9, c);
+            g.vline(charX + 7 - thick, y + 10, 8, c); }
+            break;
+        case 'C':
+            for(int thick = 0; thick < 2; thick++) {
+            g.hline(charX, y + 2 + thick, 8, c);
+            g.hline(charX, y + 16 - thick, 8, c);
+            g.vline(charX + 0 + thick, y + 2, 16, c); }
+            break;
+        case 'D':
+            for(int thick = 0; thick < 2; thick++) {
+            g.hline(charX, y + 2 + thick, 8, c);
+            g.hline(charX, y + 16 - thick, 8, c);
+            g.vline(charX + 0 + thick, y + 2, 16, c);
+            g.vline(charX + 7, y + 2, 16, c); }
+            break;
+        case 'E':
+            for(int thick = 0; thick < 2; thick++) {
+            g.hline(charX, y + 2 + thick, 9, c);
+            g.hline(charX, y + 9 + thick, 5, c);
+            g.hline(charX, y + 16 - thick, 9, c);
+            g.vline(charX + 0 + thick, y + 2, 16, c); }
+            break;
+        case 'F':
+            for(int thick = 0; thick < 2; thick++) {
+            g.hline(charX, y + 2 + thick, 9, c);
+            g.hline(charX, y + 9 + thick, 5, c);
+            g.vline(charX + 0 + thick, y + 2, 16, c); }
+            break;
+        case 'G':
+            for(int thick = 0; thick < 2; thick++) {
+            g.hline(charX, y + 2 + thick, 8, c);
+            g.hline(charX, y + 16 - thick, 8, c);
+            g.vline(charX + 0 + thick, y + 2, 16, c);
+            g.hline(charX + 5, y + 9 + thick, 3, c);
+            g.vline(charX + 7 - thick, y + 9, 9, c); }
+            break;
+        case 'H':
+            for(int thick = 0; thick < 2; thick++) {
+            g.vline(charX + 0 + thick, y + 2, 16, c);
+            g.vline(charX + 8 - thick, y + 2, 16, c);
+            g.hline(charX, y + 9 + thick, 9, c); }
+            break;
+        case 'I':
+            for(int thick = 0; thick < 2; thick++) {
+            g.hline(charX + 1, y + 2 + thick, 7, c);
+            g.hline(charX + 1, y + 16 - thick, 7, c);
+            g.vline(charX + 3 + thick, y + 2, 16, c);
+            g.vline(charX + 4, y + 2, 16, c);
+            g.vline(charX + 5 - thick, y + 2, 16, c); }
+            break;
+        case 'J':
+            for(int thick = 0; thick < 2; thick++) {
+            g.hline(charX + 2, y + 2 + thick, 7, c);
+            g.vline(charX + 8 - thick, y + 2, 16, c);
+            g.hline(charX, y + 16 - thick, 8, c); }
+            break;
+        case 'K':
+            for(int thick = 0; thick < 2; thick++) {
+            g.vline(charX + 0 + thick, y + 2, 16, c);
+            for(int py = 2; py < 10; py++) g.plotPixel(charX + 8 - (py - 2), y + py, c);
+            for(int py = 10; py < 18; py++) g.plotPixel(charX + 0 + (py - 10), y + py, c); }
+            break;
+        case 'L':
+            for(int thick = 0; thick < 2; thick++) {
+            g.vline(charX + 0 + thick, y + 2, 16, c);
+            g.hline(charX, y + 16 - thick, 9, c); }
+            break;
+        case 'M':
+            for(int thick = 0; thick < 2; thick++) {
+            g.vline(charX + 0 + thick, y + 2, 16, c);
+            g.vline(charX + 8 - thick, y + 2, 16, c);
+            g.hline(charX, y + 2 + thick, 9, c);
+            g.vline(charX + 4 - thick, y + 2, 8, c); }
+            break;
+        case 'N':
+            for(int thick = 0; thick < 2; thick++) {
+            g.vline(charX + 0 + thick, y + 2, 16, c);
+            g.vline(charX + 8 - thick, y + 2, 16, c);
+            for(int py = 2; py < 18; py++) g.plotPixel(charX + 1 + (py - 2) / 2, y + py, c); }
+            break;
+        case 'O':
+            for(int thick = 0; thick < 2; thick++) {
+            g.hline(charX, y + 2 + thick, 9, c);
+            g.hline(charX, y + 16 - thick, 9, c);
+            g.vline(charX + 0 + thick, y + 2, 16, c);
+            g.vline(charX + 8 - thick, y + 2, 16, c); }
+            break;
+        case 'P':
+            for(int thick = 0; thick < 2; thick++) {
+            g.hline(charX, y + 2 + thick, 9, c);
+            g.vline(charX + 0 + thick, y + 2, 16, c);
+            g.vline(charX + 8 - thick, y + 2, 9, c);
+            g.hline(charX + 3, y + 10 + thick, 5, c); }
+            break;
+        case 'Q':
+            for(int thick = 0; thick < 2; thick++) {
+            g.hline(charX, y + 2 + thick, 9, c);
+            g.hline(charX, y + 16 - thick, 9, c);
+            g.vline(charX + 0 + thick, y + 2, 16, c);
+            g.vline(charX + 8 - thick, y + 2, 13, c);
+            g.hline(charX + 6, y + 15 + thick, 3, c); }
+            break;
+        case 'R':
+            for(int thick = 0; thick < 2; thick++) {
+            g.hline(charX, y + 2 + thick, 9, c);
+            g.vline(charX + 0 + thick, y + 2, 16, c);
+            g.vline(charX + 8 - thick, y + 2, 9, c);
+            g.hline(charX + 3, y + 10 + thick, 5, c);
+            for(int py = 10; py < 18; py++) g.plotPixel(charX + 6 + (py - 10) / 3, y + py, c); }
+            break;
+        case 'S':
+            for(int thick = 0; thick < 2; thick++) {
+            g.hline(charX, y + 2 + thick, 9, c);
+            g.hline(charX, y + 9 + thick, 9, c);
+            g.hline(charX, y + 16 - thick, 9, c);
+            g.vline(charX + 0 + thick, y + 2, 7, c);
+            g.vline(charX + 8 - thick, y + 9, 9, c);
+            g.hline(charX, y + 8 + thick, 4, c);
+            g.hline(charX + 5, y + 10 + thick, 4, c); }
+            break;
+        case 'T':
+            for(int thick = 0; thick < 2; thick++) {
+            g.hline(charX, y + 2 + thick, 9, c);
+            g.vline(charX + 4 - thick, y + 2, 16, c); }
+            break;
+        case 'U':
+            for(int thick = 0; thick < 2; thick++) {
+            g.vline(charX + 0 + thick, y + 2, 16, c);
+            g.vline(charX + 8 - thick, y + 2, 16, c);
+            g.hline(charX, y + 16 - thick, 9, c); }
+            break;
+        case 'V':
+            for(int thick = 0; thick < 2; thick++) {
+            g.vline(charX + 0 + thick, y + 2, 11, c);
+            g.vline(charX + 8 - thick, y + 2, 11, c);
+            for(int py = 13; py < 18; py++) g.plotPixel(charX + 4 + (py - 13), y + py, c); }
+            break;
+        case 'W':
+            for(int thick = 0; thick < 2; thick++) {
+            g.vline(charX + 0 + thick, y + 2, 14, c);
+            g.vline(charX + 4 - thick, y + 2, 14, c);
+            g.vline(charX + 8 - thick, y + 2, 14, c);
+            g.vline(charX + 2 + thick, y + 12, 6, c);
+            g.vline(charX + 6 - thick, y + 12, 6, c); }
+            break;
+        case 'X':
+            for(int thick = 0; thick < 2; thick++) {
+            for(int py = 2; py < 18; py++) { int px = (py - 2) * 8 / 16 + thick; if(px >= 0 && px < 9) g.plotPixel(charX + px, y + py, c); }
+            for(int py = 2; py < 18; py++) { int px = 8 - (py - 2) * 8 / 16 + thick / 2; if(px >= 0 && px < 9) g.plotPixel(charX + px, y + py, c); } }
+            break;
+        case 'Y':
+            for(int thick = 0; thick < 2; thick++) {
+            g.vline(charX + 0 + thick, y + 2, 7, c);
+            g.vline(charX + 8 - thick, y + 2, 7, c);
+            g.vline(charX + 4 - thick, y + 9, 9, c); }
+            break;
+        case 'Z':
+            for(int thick = 0; thick < 2; thick++) {
+            g.hline(charX, y + 2 + thick, 9, c);
+            g.hline(charX, y + 16 - thick, 9, c);
+            for(int py = 2; py < 18; py++) g.plotPixel(charX + 8 - (py - 2) / 2, y + py, c); }
+            break;
+        case ':':
+            for(int thick = 0; thick < 2; thick++) {
+            g.hline(charX + 3, y + 5 + thick, 3, c);
+            g.hline(charX + 3, y + 13 + thick, 3, c); }
+            break;
+        case '.':
+            for(int thick = 0; thick < 2; thick++)
+            g.hline(charX + 3, y + 15 + thick, 3, c);
+            break;
+        case '!':
+            for(int thick = 0; thick < 2; thick++) {
+            g.vline(charX + 4 - thick, y + 2, 11, c);
+            g.hline(charX + 3, y + 14 + thick, 3, c);
+            g.hline(charX + 3, y + 17, 3, c); }
+            break;
+        case '/':
+            for(int thick = 0; thick < 2; thick++)
+            for(int py = 2; py < 18; py++) g.plotPixel(charX + 8 - (py - 2) / 2, y + py, c);
+            break;
+        case '=':
+            for(int thick = 0; thick < 2; thick++) {
+            g.hline(charX, y + 6 + thick, 9, c);
+            g.hline(charX, y + 12 + thick, 9, c); }
+            break;
+        case '0':
+            for(int thick = 0; thick < 2; thick++) {
+            g.hline(charX, y + 2 + thick, 9, c);
+            g.hline(charX, y + 16 - thick, 9, c);
+            g.vline(charX + 0 + thick, y + 2, 16, c);
+            g.vline(charX + 8 - thick, y + 2, 16, c); }
+            break;
+        case '1':
+            for(int thick = 0; thick < 2; thick++) {
+            g.hline(charX + 1, y + 2 + thick, 3, c);
+            g.vline(charX + 4 - thick, y + 2, 14, c);
+            g.hline(charX + 1, y + 16 - thick, 7, c); }
+            break;
+        case '2':
+            for(int thick = 0; thick < 2; thick++) {
+            g.hline(charX, y + 2 + thick, 9, c);
+            g.vline(charX + 8 - thick, y + 2, 7, c);
+            g.hline(charX, y + 9 + thick, 9, c);
+            g.vline(charX + 0 + thick, y + 9, 9, c);
+            g.hline(charX, y + 16 - thick, 9, c); }
+            break;
+        case '3':
+            for(int thick = 0; thick < 2; thick++) {
+            g.hline(charX, y + 2 + thick, 9, c);
+            g.hline(charX, y + 9 + thick, 9, c);
+            g.hline(charX, y + 16 - thick, 9, c);
+            g.vline(charX + 8 - thick, y + 2, 16, c); }
+            break;
+        case '4':
+            for(int thick = 0; thick < 2; thick++) {
+            g.vline(charX + 0 + thick, y + 2, 8, c);
+            g.hline(charX, y + 9 + thick, 9, c);
+            g.vline(charX + 8 - thick, y + 2, 16, c); }
+            break;
+        case '5':
+            for(int thick = 0; thick < 2; thick++) {
+            g.hline(charX, y + 2 + thick, 9, c);
+            g.vline(charX + 0 + thick, y + 2, 8, c);
+            g.hline(charX, y + 9 + thick, 9, c);
+            g.vline(charX + 8 - thick, y + 9, 9, c);
+            g.hline(charX, y + 16 - thick, 9, c); }
+            break;
+        case '6':
+            for(int thick = 0; thick < 2; thick++) {
+            g.hline(charX, y + 2 + thick, 9, c);
+            g.vline(charX + 0 + thick, y + 2, 16, c);
+            g.hline(charX, y + 9 + thick, 9, c);
+            g.hline(charX, y + 16 - thick, 9, c);
+            g.vline(charX + 8 - thick, y + 9, 9, c); }
+            break;
+        case '7':
+            for(int thick = 0; thick < 2; thick++) {
+            g.hline(charX, y + 2 + thick, 9, c);
+            for(int py = 2; py < 18; py++) g.plotPixel(charX + 8 - (py - 2) / 2, y + py, c); }
+            break;
+        case '8':
+            for(int thick = 0; thick < 2; thick++) {
+            g.hline(charX, y + 2 + thick, 9, c);
+            g.hline(charX, y + 9 + thick, 9, c);
+            g.hline(charX, y + 16 - thick, 9, c);
+            g.vline(charX + 0 + thick, y + 2, 16, c);
+            g.vline(charX + 8 - thick, y + 2, 16, c); }
+            break;
+        case '9':
+            for(int thick = 0; thick < 2; thick++) {
+            g.hline(charX, y + 2 + thick, 9, c);
+            g.hline(charX, y + 9 + thick, 9, c);
+            g.vline(charX + 0 + thick, y + 2, 9, c);
+            g.vline(charX + 8 - thick, y + 2, 16, c);
+            g.hline(charX, y + 16 - thick, 9, c); }
+            break;
+        default:
+            for(int thick = 0; thick < 2; thick++) {
+            g.hline(charX + 1, y + 4 + thick, 7, c);
+            g.hline(charX + 1, y + 16 - thick, 7, c);
+            g.vline(charX + 1 + thick, y + 4, 12, c);
+            g.vline(charX + 7 - thick, y + 4, 12, c); }
+            break;
+    }
+}
+
+// TEXT WIDTH
+int FontRenderer::smallTextWidth(const std::string& text) {
+    const int smallWidth = 15;
+    int width = 0;
+
+    // Matches drawSmall: a space also shifts the rest by half a cell
+    for(char ch : text) {
+        width += smallWidth;
+        if(ch == ' ') width += smallWidth / 2;
+    }
+    return width;
+}
+
+int FontRenderer::largeTextWidth(const std::string& text) {
+    const int letterWidth = 30;
+    int width = 0;
+
+    // Matches drawLarge: a space also shifts the rest by an eighth of a cell
+    for(char ch : text) {
+        width += letterWidth;
+        if(ch == ' ') width += letterWidth / 8;
+    }
+    return width;
+}
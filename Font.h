@@ -11,6 +11,10 @@
 #include "SDL_Plotter.h"
 #include <string>
 
+// Glyph atlas bounds: row masks are 32 bits, the tallest glyph ends on row 36
+const int GLYPH_MAX_WIDTH = 32;
+const int GLYPH_MAX_ROWS = 40;
+
 class FontRenderer {
 public:
     /*
@@ -21,6 +25,14 @@ public:
      */
     static void drawLarge(SDL_Plotter& g, int x, int y, color c, const string& text, int flashTimer = 0);
 
+    /*
+     * Description: Draw large pixel font text from a character range
+     * Return: void
+     * Pre-condition: text points at length characters
+     * Post-condition: Same pixels as drawLarge with a string
+     */
+    static void drawLargeChars(SDL_Plotter& g, int x, int y, color c, const char* text, size_t length, int flashTimer = 0);
+
     /*
      * Description: Draw small pixel font text
      * Return: void
@@ -28,6 +40,48 @@ public:
      * Post-condition: Small text rendered at position with optional flash
      */
     static void drawSmall(SDL_Plotter& g, int x, int y, color c, const string& text, int flashTimer = 0);
+
+    /*
+     * Description: Draw small pixel font text from a character range
+     * Return: void
+     * Pre-condition: text points at length characters
+     * Post-condition: Same pixels as drawSmall with a string
+     */
+    static void drawSmallChars(SDL_Plotter& g, int x, int y, color c, const char* text, size_t length, int flashTimer = 0);
+
+    /*
+     * Description: Width drawLarge covers for a string
+     * Return: int - pixels from x to the right edge of the last cell
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    static int largeTextWidth(const string& text);
+
+    /*
+     * Description: Width drawSmall covers for a string
+     * Return: int - pixels from x to the right edge of the last cell
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    static int smallTextWidth(const string& text);
+
+    /*
+     * Description: Draw one large glyph stroke by stroke, the shape the
+     *              glyph atlas is rasterized from
+     * Return: void
+     * Pre-condition: SDL_Plotter g initialized
+     * Post-condition: Glyph ch drawn with its cell at charX, y
+     */
+    static void strokeLarge(SDL_Plotter& g, int charX, int y, color c, char ch);
+
+    /*
+     * Description: Draw one small glyph stroke by stroke, the shape the
+     *              glyph atlas is rasterized from
+     * Return: void
+     * Pre-condition: SDL_Plotter g initialized
+     * Post-condition: Glyph ch drawn with its cell at charX, y
+     */
+    static void strokeSmall(SDL_Plotter& g, int charX, int y, color c, char ch);
 };
 
 #endif /* FONT_H_ */
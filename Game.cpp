@@ -0,0 +1,259 @@
+//================================================================
+// Game.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Game Implementation
+// Description: State machine, simulation tick, and scene drawing
+//================================================================
+
+#include "Game.h"
+#include "Collision.h"
+#include "Utils.h"
+
+Game::Game(uint64_t seed)
+    : rng(seed),
+      playerCar(PLAYER_START_X, PLAYER_START_Y, PLAYER_CAR),
+      carTarget{TRAFFIC_AI_CARS},
+      obstacleTarget{TRAFFIC_OBSTACLES},
+      gameState{STATE_START},
+      sweptCollisions{false},
+      collisionCooldown{0},
+      frameCount{0},
+      tickCount{0}
+{
+    traffic.reserve(TRAFFIC_AI_CARS, TRAFFIC_OBSTACLES);
+    reset(seed);
+}
+
+void Game::reset(uint64_t seed) {
+    rng.setSeed(seed);
+    playerCar = PlayerCar(PLAYER_START_X, PLAYER_START_Y, PLAYER_CAR);
+    bg = Background();
+    points.reset();
+
+    // Rebuilt in place; capacity is kept so resets never allocate
+    traffic.clear();
+    for (int i = 0; i < TRAFFIC_AI_CARS; i++) {
+        traffic.addCar(LANE_X[i], TRAFFIC_CAR_Y[i], TRAFFIC_COLORS[i], TRAFFIC_SPEEDS[i], rng);
+    }
+    for (int i = 0; i < TRAFFIC_OBSTACLES; i++) {
+        traffic.addCone(LANE_X[i], TRAFFIC_CONE_Y[i], OBSTACLE_SIZE);
+    }
+
+    gameState = STATE_START;
+    startScreen = StartScreen();
+    instructionsScreen = InstructionsScreen();
+    pauseScreen = PauseScreen();
+    gameOverScreen = GameOverScreen();
+    winScreen = WinScreen();
+
+    playerFrom = playerShown = playerCar.getLoc();
+    collisionCooldown = 0;
+    frameCount = 0;
+    tickCount = 0;
+}
+
+void Game::restart() {
+    playerCar.respawn();
+    playerFrom = playerShown = playerCar.getLoc();
+    bg = Background();
+    points.reset();
+    collisionCooldown = 0;
+    frameCount = 0;
+
+    for (int i = 0; i < traffic.getCarCount(); i++) traffic.respawnCar(i, rng);
+    for (int i = 0; i < traffic.getConeCount(); i++) traffic.respawnCone(i, rng);
+
+    gameState = STATE_START;
+}
+
+// SNAPSHOTS
+void Game::save(StateWriter& w) const {
+    rng.save(w);
+    w.putInt(gameState);
+    w.putInt(collisionCooldown);
+    w.putInt(frameCount);
+    w.putInt(tickCount);
+
+    playerCar.save(w);
+    bg.save(w);
+    points.save(w);
+
+    traffic.save(w);
+
+    startScreen.save(w);
+    instructionsScreen.save(w);
+    pauseScreen.save(w);
+    gameOverScreen.save(w);
+    winScreen.save(w);
+}
+
+bool Game::load(StateReader& r) {
+    rng.load(r);
+    int state = r.getInt();
+    if (state < STATE_START || state > STATE_WIN) return false;
+    gameState = static_cast<GameState>(state);
+    collisionCooldown = r.getInt();
+    frameCount = r.getInt();
+    tickCount = r.getInt();
+
+    playerCar.load(r);
+    playerFrom = playerShown = playerCar.getLoc();
+    bg.load(r);
+    points.load(r);
+
+    // Traffic is rebuilt in saved order, which is all later ticks
+    // depend on
+    if (!traffic.load(r)) return false;
+
+    startScreen.load(r);
+    instructionsScreen.load(r);
+    pauseScreen.load(r);
+    gameOverScreen.load(r);
+    winScreen.load(r);
+    return r.good();
+}
+
+// INPUT
+void Game::handleInput(char c) {
+    if (c == '\0') return;
+
+    switch (gameState) {
+        case STATE_START:
+            if (c == 'I') {
+                gameState = STATE_INSTRUCTIONS;
+            } else if (startScreen.handleInput(c)) {
+                gameState = STATE_PLAYING;
+            }
+            break;
+
+        case STATE_INSTRUCTIONS:
+            if (c == 'S')      gameState = STATE_PLAYING;
+            else if (c == 'B') gameState = STATE_START;
+            break;
+
+        case STATE_PLAYING:
+            switch(c) {
+                case RIGHT_ARROW: playerCar.move(RIGHT_ARROW); break;
+                case LEFT_ARROW:  playerCar.move(LEFT_ARROW);  break;
+                case UP_ARROW:    playerCar.move(UP_ARROW);    break;
+                case DOWN_ARROW:  playerCar.move(DOWN_ARROW);  break;
+                case 'P':         gameState = STATE_PAUSED;    break;
+            }
+            break;
+
+        case STATE_PAUSED:
+            if (pauseScreen.handleInput(c)) {
+                gameState = STATE_PLAYING;
+            } else if (c == 'B') {
+                gameState = STATE_START;
+            }
+            break;
+
+        case STATE_GAME_OVER:
+            if (gameOverScreen.handleInput(c)) restart();
+            break;
+
+        case STATE_WIN:
+            if (winScreen.handleInput(c)) restart();
+            break;
+    }
+}
+
+// TICK
+void Game::tick() {
+    switch (gameState) {
+        case STATE_START:        startScreen.update();        break;
+        case STATE_INSTRUCTIONS: instructionsScreen.update(); break;
+        case STATE_PAUSED:       pauseScreen.update();        break;
+        case STATE_GAME_OVER:    gameOverScreen.update();     break;
+        case STATE_WIN:          winScreen.update();          break;
+        case STATE_PLAYING:      tickPlaying();               break;
+    }
+    tickCount++;
+}
+
+void Game::tickPlaying() {
+    playerShown = playerFrom;
+    bg.update(playerCar.getSpeed());
+    points.updateSpeed(playerCar.getSpeed());
+    points.update();
+    playerCar.update(bg.getOffset()); // currently does nothing (input-driven)
+
+    traffic.spawn(carTarget, obstacleTarget, rng);
+
+    // Update AI and obstacles. Obstacles only move after every AI car
+    // has decided, so one index serves the whole pass. Traffic leaving
+    // the screen respawns above it, unless there is more than the target:
+    // then it is dropped, and the last entity takes its place.
+    lanes.build(traffic);
+    int passed = traffic.updateCars(lanes, rng, carTarget);   // obstacle-aware AI
+    for (int i = 0; i < passed; i++) points.addCarPass();
+
+    int avoided = traffic.updateCones(playerCar.getSpeed(), rng, obstacleTarget);
+    for (int i = 0; i < avoided; i++) points.addObstacleAvoided();
+
+    // Collision detection
+    if (collisionCooldown <= 0) {
+        bool hitAI = false, hitObstacle = false;
+        if (sweptCollisions) {
+            float toi;
+            traffic.updateGrids();
+            Collision::sweepAllCollisions(playerFrom, playerCar, traffic,
+                                          hitAI, hitObstacle, toi);
+        } else {
+            Collision::checkAllCollisions(playerCar, traffic, hitAI, hitObstacle);
+        }
+
+        if (hitAI || hitObstacle) {
+            playerCar.setSpeed(max(MIN_SPEED, playerCar.getSpeed() - COLLISION_SPEED_PENALTY));
+            int newScore = max(0, points.getScore() - COLLISION_POINTS_PENALTY);
+            gameOverScreen.setGameOver(newScore, hitAI, hitObstacle);
+            gameState = STATE_GAME_OVER;
+        }
+    } else {
+        collisionCooldown--;
+    }
+
+    // Win condition
+    if (points.getScore() >= POINTS_PER_LAP * MAX_LAPS) {
+        winScreen.setWin(points.getScore());
+        gameState = STATE_WIN;
+    }
+
+    playerFrom = playerCar.getLoc();
+    frameCount++;
+}
+
+void Game::setTraffic(int cars, int cones) {
+    carTarget = cars;
+    obstacleTarget = cones;
+    traffic.reserve(cars, cones);
+}
+
+// DRAW
+void Game::draw(SDL_Plotter& g, double alpha) {
+    switch (gameState) {
+        case STATE_START:        startScreen.draw(g);        break;
+        case STATE_INSTRUCTIONS: instructionsScreen.draw(g); break;
+        case STATE_PAUSED:       pauseScreen.draw(g);        break;
+        case STATE_GAME_OVER:    gameOverScreen.draw(g);     break;
+        case STATE_WIN:          winScreen.draw(g);          break;
+        case STATE_PLAYING:      recordRace(alpha).execute(g); break;
+    }
+}
+
+const DrawList& Game::recordRace(double alpha) {
+    drawList.clear();
+    bg.draw(drawList, alpha);
+    traffic.draw(drawList, alpha);
+    Car::drawAt(drawList, LAYER_PLAYER, blend(playerShown, playerCar.getLoc(), alpha),
+                playerCar.getColor(), playerCar.getSize());
+
+    // HUD
+    color hudColor(255, 255, 255);
+    string scoreStr = "Score: " + to_string(points.getScore());
+    string speedStr = "Speed: " + to_string(playerCar.getSpeed());
+    drawList.text(LAYER_HUD, 10, 20, hudColor, scoreStr, false);
+    drawList.text(LAYER_HUD, 10, 50, hudColor, speedStr, false);
+    return drawList;
+}
@@ -0,0 +1,232 @@
+//================================================================
+// Game.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Game Class
+// Description: Game state machine, fixed-rate simulation & drawing
+//================================================================
+
+#ifndef Game_h
+#define Game_h
+
+#include "Const.h"
+#include "Car.h"
+#include "Background.h"
+#include "DrawList.h"
+#include "LaneIndex.h"
+#include "TrafficStore.h"
+#include "Screen.h"
+#include "Points.h"
+#include "Random.h"
+#include "State.h"
+
+class Game {
+private:
+    Random             rng;                // Per-game generator, drives all spawns
+    PlayerCar          playerCar;          // Keyboard controlled car
+    Background         bg;                 // Scrolling road
+    PointsManager      points;             // Score tracking
+    TrafficStore       traffic;            // AI cars and cones, with their grids
+    int                carTarget;          // Live AI cars to keep on the road
+    int                obstacleTarget;     // Live obstacles to keep on the road
+    LaneIndex          lanes;              // Cones by lane, for AI decisions
+    DrawList           drawList;           // Last recorded race frame, storage reused
+
+    GameState          gameState;          // Current state machine state
+    StartScreen        startScreen;
+    InstructionsScreen instructionsScreen;
+    PauseScreen        pauseScreen;
+    GameOverScreen     gameOverScreen;
+    WinScreen          winScreen;
+
+    bool  sweptCollisions;  // Test whole moves, not just end positions
+    point playerFrom;       // Player position when the tick began
+    point playerShown;      // Player position drawn before the last tick
+
+    int collisionCooldown;  // Ticks left before collisions count again
+    int frameCount;         // Simulation ticks spent in STATE_PLAYING
+    int tickCount;          // Simulation ticks since construction
+
+    /*
+     * Description: Reset player, road, score and traffic for a new race
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Game back at STATE_START with fresh entities
+     */
+    void restart();
+
+    /*
+     * Description: Advance one tick of racing (movement, score, collisions)
+     * Return: void
+     * Pre-condition: gameState is STATE_PLAYING
+     * Post-condition: Entities moved, may transition to game over or win
+     */
+    void tickPlaying();
+
+public:
+    /*
+     * Description: Initialize game at the start screen
+     * Return: None (constructor)
+     * Pre-condition: None
+     * Post-condition: Game created in STATE_START, traffic fixed by seed
+     */
+    explicit Game(uint64_t seed);
+
+    /*
+     * Description: Put the game back exactly as constructed with seed
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Same state as Game(seed), no memory allocated
+     */
+    void reset(uint64_t seed);
+
+    /*
+     * Description: Apply one key press to the state machine
+     * Return: void
+     * Pre-condition: key is uppercase, an arrow constant, or '\0' for none
+     * Post-condition: Player moved or game state changed per key
+     */
+    void handleInput(char key);
+
+    /*
+     * Description: Advance the simulation by one fixed tick
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Current state's animations and logic stepped once
+     */
+    void tick();
+
+    /*
+     * Description: Draw the current state without advancing it, race
+     *              movement alpha of the way through the last tick
+     * Return: void
+     * Pre-condition: SDL_Plotter g is initialized, ROW x COL,
+     *                0 <= alpha <= 1
+     * Post-condition: Current state rendered to plotter; every pixel is
+     *                 written, so no clear() is needed beforehand
+     */
+    void draw(SDL_Plotter& g, double alpha = 1.0);
+
+    /*
+     * Description: Record road, traffic, player and HUD for this tick,
+     *              movement alpha of the way through it
+     * Return: const DrawList& - the race frame, valid until the next call
+     * Pre-condition: 0 <= alpha <= 1
+     * Post-condition: Previous recording replaced; executing the list
+     *                 writes every pixel of a ROW x COL plotter
+     */
+    const DrawList& recordRace(double alpha = 1.0);
+
+    /*
+     * Description: Choose between end-of-tick and swept collision tests.
+     *              Swept tests also catch entities that pass through or
+     *              clip the player during a tick, so coarse steps lose
+     *              nothing; they are off by default because they end some
+     *              races the end-of-tick tests let through, which would
+     *              break recorded replays
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Mode kept across reset() and restarts
+     */
+    void setSweptCollisions(bool swept) { sweptCollisions = swept; }
+
+    /*
+     * Description: Set how many AI cars and obstacles to keep on the road.
+     *              Missing ones spawn above the screen on the next tick;
+     *              extra ones are released as they leave the screen
+     * Return: void
+     * Pre-condition: 0 <= cars, obstacles <= TRAFFIC_MAX
+     * Post-condition: Storage reserved to the targets, so density changes
+     *                 never reallocate; kept across reset() and restarts
+     */
+    void setTraffic(int cars, int obstacles);
+
+    /*
+     * Description: Get current game state
+     * Return: GameState - current state machine state
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    GameState getState() const { return gameState; }
+
+    /*
+     * Description: Get the score tracker
+     * Return: const PointsManager& - current points
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    const PointsManager& getPoints() const { return points; }
+
+    /*
+     * Description: Get the player's car
+     * Return: const PlayerCar& - player
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    const PlayerCar& getPlayer() const { return playerCar; }
+
+    /*
+     * Description: Get the AI cars and obstacles
+     * Return: const TrafficStore& - live traffic in update order
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    const TrafficStore& getTraffic() const { return traffic; }
+
+    /*
+     * Description: Check if the last race ended on an AI car
+     * Return: bool - true if an AI car caused the game over
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    bool getHitAI() const { return gameOverScreen.getHitAI(); }
+
+    /*
+     * Description: Check if the last race ended on an obstacle
+     * Return: bool - true if an obstacle caused the game over
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    bool getHitObstacle() const { return gameOverScreen.getHitObstacle(); }
+
+    /*
+     * Description: Get number of ticks spent racing this game
+     * Return: int - frame count
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    int getFrameCount() const { return frameCount; }
+
+    /*
+     * Description: Get number of ticks run in any state
+     * Return: int - tick count, the clock replays are keyed on
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    int getTick() const { return tickCount; }
+
+    /*
+     * Description: Get seed this game was started with
+     * Return: uint64_t - seed
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    uint64_t getSeed() const { return rng.getSeed(); }
+
+    /*
+     * Description: Append the full game state to a snapshot
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Every entity, counter and the RNG encoded into w
+     */
+    void save(StateWriter& w) const;
+
+    /*
+     * Description: Restore the full game state from a snapshot
+     * Return: bool - false if the snapshot is truncated or malformed
+     * Pre-condition: r positioned at data written by save()
+     * Post-condition: Game continues exactly as the saved one would
+     */
+    bool load(StateReader& r);
+};
+
+#endif /* Game_h */
@@ -0,0 +1,47 @@
+//================================================================
+// LaneIndex.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Lane Occupancy Index Implementation
+// Description: Bucketing and binary-searched lookahead
+//================================================================
+
+#include "LaneIndex.h"
+#include "Obstacle.h"
+#include "TrafficStore.h"
+#include <algorithm>
+#include <cstdlib>
+
+// BUILD
+void LaneIndex::build(const vector<Obstacle>& obstacles) {
+    for(vector<int>& lane : ys) lane.clear();
+
+    for(const Obstacle& obs : obstacles) {
+        point loc = obs.getLocation();
+        int half = obs.getSize() / 2;
+        for(int l = LEFT_LANE; l <= RIGHT_LANE; l++) {
+            if(abs(loc.x - LANE_X[l]) <= half) ys[l].push_back(loc.y);
+        }
+    }
+    for(vector<int>& lane : ys) sort(lane.begin(), lane.end());
+}
+
+void LaneIndex::build(const TrafficStore& traffic) {
+    for(vector<int>& lane : ys) lane.clear();
+
+    for(int i = 0; i < traffic.getConeCount(); i++) {
+        point loc = traffic.getConeLoc(i);
+        int half = traffic.getConeSize(i) / 2;
+        for(int l = LEFT_LANE; l <= RIGHT_LANE; l++) {
+            if(abs(loc.x - LANE_X[l]) <= half) ys[l].push_back(loc.y);
+        }
+    }
+    for(vector<int>& lane : ys) sort(lane.begin(), lane.end());
+}
+
+// QUERY
+bool LaneIndex::blockedAhead(AILane lane, int y, int distance) const {
+    // Nearest obstacle strictly below y, then whether it is close enough
+    const vector<int>& sorted = ys[lane];
+    vector<int>::const_iterator ahead = upper_bound(sorted.begin(), sorted.end(), y);
+    return ahead != sorted.end() && *ahead - y < distance;
+}
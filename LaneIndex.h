@@ -0,0 +1,51 @@
+//================================================================
+// LaneIndex.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Lane Occupancy Index
+// Description: Obstacles bucketed by lane and sorted by y, built once
+//              per tick for AI lane decisions
+//================================================================
+
+#ifndef LaneIndex_h
+#define LaneIndex_h
+
+#include "Const.h"
+#include <vector>
+
+class Obstacle;      // Forward declarations
+class TrafficStore;
+
+class LaneIndex {
+private:
+    vector<int> ys[3];          // Obstacle y per AILane, ascending
+
+public:
+    /*
+     * Description: Bucket obstacles by the lanes they sit in
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: An obstacle is in a lane when its center is within
+     *                 half its size of the lane x; storage kept between
+     *                 builds
+     */
+    void build(const vector<Obstacle>& obstacles);
+
+    /*
+     * Description: Bucket a traffic store's cones by the lanes they sit in
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: As build over the same cones as Obstacle objects
+     */
+    void build(const TrafficStore& traffic);
+
+    /*
+     * Description: Check for an obstacle ahead of y in a lane
+     * Return: bool - true if some obstacle y satisfies
+     *                y < obstacle y < y + distance
+     * Pre-condition: build called since obstacles last moved
+     * Post-condition: No state change
+     */
+    bool blockedAhead(AILane lane, int y, int distance) const;
+};
+
+#endif /* LaneIndex_h */
@@ -0,0 +1,46 @@
+//================================================================
+// LaneRule.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: AI Lane Decision Rule
+// Description: The one lane choice every AI car makes when its timer
+//              runs out, shared by AICar, TrafficStore and BatchEngine;
+//              each brings its own way of telling a lane is blocked
+//================================================================
+
+#ifndef LaneRule_h
+#define LaneRule_h
+
+#include "Const.h"
+#include "Random.h"
+
+class LaneRule {
+public:
+    /*
+     * Description: Pick the lane an AI car steers for: out of a blocked
+     *              lane into a random clear one, otherwise now and then
+     *              into a random clear other lane
+     * Return: int - AILane to steer for, currentLane if none is picked
+     * Pre-condition: blocked(lane) returns true if a cone sits ahead of
+     *                the car in that AILane
+     * Post-condition: rng advanced once or twice
+     */
+    template <class Blocked>
+    static int decide(int currentLane, Random& rng, Blocked blocked) {
+        bool isBlocked[3] = { blocked(LEFT_LANE), blocked(CENTER_LANE), blocked(RIGHT_LANE) };
+        int candidates[3];
+        int n = 0;
+
+        if(isBlocked[currentLane]) {
+            for(int l = LEFT_LANE; l <= RIGHT_LANE; l++) {
+                if(!isBlocked[l]) candidates[n++] = l;
+            }
+        } else if(rng.nextInt(100) < AI_LANE_CHANGE_THRESHOLD) {
+            for(int l = LEFT_LANE; l <= RIGHT_LANE; l++) {
+                if(l != currentLane && !isBlocked[l]) candidates[n++] = l;
+            }
+        }
+        return n > 0 ? candidates[rng.nextInt(n)] : currentLane;
+    }
+};
+
+#endif /* LaneRule_h */
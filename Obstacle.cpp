@@ -2,49 +2,57 @@
 // Obstacle.cpp
 // Author: Jody Spikes, Hailey Pieper, Ian Dudley
 // Title: Obstacle Implementation
-// Description: Traffic cone obstacles with collision detection
+// Description: Traffic cone handles forwarding to their store, and
+//              the cone sprite
 //================================================================
 
 #include "Obstacle.h"
 #include "Car.h"
+#include "Sprite.h"
 
-Obstacle::Obstacle(int x, int y, int size)
-    : _loc{point(x, y)},
-      _size{size},
-      _active{true}
+Obstacle::Obstacle(TrafficStore& store, int x, int y, int size)
+    : _store{&store},
+      _index{store.addCone(x, y, size)}
 {}
 
 void Obstacle::update(int playerSpeed) {
-    if(!_active) return;
-
-    _loc.y += playerSpeed;
+    _store->updateCone(_index, playerSpeed);
 }
 
-void Obstacle::draw(SDL_Plotter& g) {
-    if(!_active) return;
+/*
+ * Description: Striped traffic cone, painted once per size
+ * Return: const Sprite& - sprite centered on column (size - 1) / 2
+ * Pre-condition: size > 0
+ * Post-condition: Sprite cached for the rest of the run
+ */
+static const Sprite& coneSprite(int size) {
+    static SpriteCache sprites;
+    int center = (size - 1) / 2;
+
+    return sprites.get((uint64_t)size, 2 * center + 1, size, [&](SDL_Plotter& g) {
+        // TRAFFIC CONE BASE
+        for(int y = 0; y < size; y++) {
+            int halfWidth = y / 2;
+
+            // STRIPES
+            color stripe = (y / OBSTACLE_STRIPE_HEIGHT % 2 == 0) ? ORANGE : WHITE2;
+            g.hline(center - halfWidth, y, 2 * halfWidth + 1, stripe);
+        }
+    });
+}
 
-    // TRAFFIC CONE BASE
-    for(int y = 0; y < _size; y++) {
-        int width = (y * _size) / _size;
-        for(int x = -width / 2; x <= width / 2; x++) {
-            int drawX = _loc.x + x;
-            int drawY = _loc.y - _size / 2 + y;
+void Obstacle::draw(DrawList& list) const {
+    _store->drawCone(_index, list);
+}
 
-            if(drawX >= 0 && drawX < ROW && drawY >= 0 && drawY < COL) {
-                // STRIPES
-                if(y / OBSTACLE_STRIPE_HEIGHT % 2 == 0) {
-                    g.plotPixel(drawX, drawY, ORANGE);
-                } else {
-                    g.plotPixel(drawX, drawY, WHITE2);
-                }
-            }
-        }
-    }
+void Obstacle::drawAt(DrawList& list, point loc, int size) {
+    const Sprite& cone = coneSprite(size);
+    list.sprite(LAYER_OBSTACLES, cone, loc.x - cone.getWidth() / 2, loc.y - size / 2);
 }
 
 bool Obstacle::collidesWith(const Car& car) const {
-    if(!_active) return false;
-
+    point loc = getLocation();
+    int size = getSize();
     point carLoc = car.getLoc();
     int carSize = car.getSize();
 
@@ -55,10 +63,10 @@ bool Obstacle::collidesWith(const Car& car) const {
     int carBottom = carLoc.y + carSize / 2;
 
     // OBSTACLE BOUNDS
-    int obsLeft = _loc.x - _size / 2;
-    int obsRight = _loc.x + _size / 2;
-    int obsTop = _loc.y - _size / 2;
-    int obsBottom = _loc.y + _size / 2;
+    int obsLeft = loc.x - size / 2;
+    int obsRight = loc.x + size / 2;
+    int obsTop = loc.y - size / 2;
+    int obsBottom = loc.y + size / 2;
 
     // COLLISION DETECTION
     return (carRight > obsLeft &&
@@ -67,29 +75,10 @@ bool Obstacle::collidesWith(const Car& car) const {
             carTop < obsBottom);
 }
 
-bool Obstacle::isOffScreen() const {
-    return _loc.y > COL + _size;
-}
-
-void Obstacle::respawn() {
-    _loc.x = ROAD_START + OBSTACLE_SPAWN_MIN_X_OFFSET +
-             (rand() % (ROAD_WIDTH - OBSTACLE_SPAWN_MAX_X_OFFSET));
-    _loc.y = -_size - (rand() % OBSTACLE_SPAWN_Y_RANDOM_RANGE);
-    _active = true;
-}
-
-void Obstacle::deactivate() {
-    _active = false;
-}
-
-bool Obstacle::isActive() const {
-    return _active;
-}
-
-point Obstacle::getLocation() const {
-    return _loc;
+void Obstacle::respawn(Random& rng) {
+    _store->respawnCone(_index, rng);
 }
 
-int Obstacle::getSize() const {
-    return _size;
+void Obstacle::remove() {
+    _store->removeCone(_index);
 }
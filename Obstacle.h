@@ -2,30 +2,44 @@
 // Obstacle.h
 // Author: Jody Spikes, Hailey Pieper, Ian Dudley
 // Title: Obstacle Class
-// Description: Traffic cone obstacles with collision detection
+// Description: Handle on one traffic cone of a TrafficStore, with
+//              collision detection
 //================================================================
 
 #ifndef Obstacle_h
 #define Obstacle_h
 
 #include "Const.h"
+#include "DrawList.h"
+#include "Random.h"
+#include "TrafficStore.h"
 
 class Car;
 
+// OBSTACLE HANDLE - ONE CONE OF A TRAFFIC STORE
+
 class Obstacle {
 private:
-    point _loc;		// Current position on screen
-    int _size;		// Obstacle size in pixels
-    bool _active;	// Whether obstacle is active and drawn
+    TrafficStore* _store;	// Store holding the cone's components
+    int _index;			// The cone's index in the store
 
 public:
     /*
-     * Description: Initialize obstacle at position with size
+     * Description: Refer to a cone already in a store
+     * Return: None (constructor)
+     * Pre-condition: 0 <= index < store.getConeCount()
+     * Post-condition: Handle on that index; removing a cone moves the
+     *                 store's last cone into its index
+     */
+    Obstacle(TrafficStore& store, int index) : _store{&store}, _index{index} {}
+
+    /*
+     * Description: Add an obstacle to a store at position with size
      * Return: None (constructor)
      * Pre-condition: x, y within valid bounds
-     * Post-condition: Obstacle created at (x, y) with active state
+     * Post-condition: Cone appended to store at (x, y)
      */
-    Obstacle(int x, int y, int size = OBSTACLE_SIZE);
+    Obstacle(TrafficStore& store, int x, int y, int size = OBSTACLE_SIZE);
 
     /*
      * Description: Move obstacle down screen based on player speed
@@ -36,12 +50,21 @@ public:
     void update(int playerSpeed);
 
     /*
-     * Description: Draw obstacle as striped traffic cone
+     * Description: Record obstacle as striped traffic cone
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Cone appended to list on LAYER_OBSTACLES
+     */
+    void draw(DrawList& list) const;
+
+    /*
+     * Description: Record a traffic cone without an Obstacle object
      * Return: void
-     * Pre-condition: SDL_Plotter g is initialized
-     * Post-condition: Obstacle rendered to screen if active
+     * Pre-condition: size > 0
+     * Post-condition: Cone centered on loc appended to list on
+     *                 LAYER_OBSTACLES
      */
-    void draw(SDL_Plotter& g);
+    static void drawAt(DrawList& list, point loc, int size);
 
     /*
      * Description: Check collision between obstacle and car
@@ -57,39 +80,41 @@ public:
      * Pre-condition: None
      * Post-condition: No state change
      */
-    bool isOffScreen() const;
+    bool isOffScreen() const { return _store->isConeOffScreen(_index); }
 
     /*
      * Description: Reposition obstacle at top with random X position
      * Return: void
-     * Pre-condition: None
-     * Post-condition: Obstacle reset to top of screen, active = true
+     * Pre-condition: rng is the game's
+     * Post-condition: Obstacle reset to top of screen
      */
-    void respawn();
+    void respawn(Random& rng);
 
     /*
-     * Description: Deactivate obstacle (prevent drawing and collision)
+     * Description: Take obstacle off the road (no drawing or collision)
      * Return: void
      * Pre-condition: None
-     * Post-condition: Active state set to false
+     * Post-condition: Cone removed from its store; this handle now
+     *                 refers to the cone that took its index, if any
      */
-    void deactivate();
+    void remove();
 
     /*
-     * Description: Get active status of obstacle
-     * Return: bool - current value of active state
+     * Description: Get obstacle location
+     * Return: point - current position
      * Pre-condition: None
      * Post-condition: No state change
      */
-    bool isActive() const;
+    point getLocation() const { return _store->getConeLoc(_index); }
 
     /*
-     * Description: Get obstacle location
-     * Return: point - current position
+     * Description: Get obstacle location before the last update
+     * Return: point - previous position, equal to the current one after
+     *                 construction, respawn or load
      * Pre-condition: None
      * Post-condition: No state change
      */
-    point getLocation() const;
+    point getPrvLoc() const { return _store->getConePrvLoc(_index); }
 
     /*
      * Description: Get obstacle size
@@ -97,7 +122,15 @@ public:
      * Pre-condition: None
      * Post-condition: No state change
      */
-    int getSize() const;
+    int getSize() const { return _store->getConeSize(_index); }
+
+    /*
+     * Description: Get the cone's index in its store
+     * Return: int - index
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    int getIndex() const { return _index; }
 };
 
 #endif /* Obstacle_h */
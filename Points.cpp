@@ -6,6 +6,7 @@
 //================================================================
 
 #include "Points.h"
+#include <cstring>
 
 PointsManager::PointsManager()
     : score{0},
@@ -53,3 +54,26 @@ void PointsManager::addObstacleAvoided() {
     score += points;
     obstaclesAvoided++;
 }
+
+void PointsManager::save(StateWriter& w) const {
+    // Multiplier stored bit-exact so restored games score identically
+    uint32_t bits;
+    memcpy(&bits, &speedMultiplier, sizeof(bits));
+
+    w.putInt(score);
+    w.putInt(baseSpeed);
+    w.putU32(bits);
+    w.putInt(carsPassed);
+    w.putInt(obstaclesAvoided);
+    w.putInt(frameCounter);
+}
+
+void PointsManager::load(StateReader& r) {
+    score = r.getInt();
+    baseSpeed = r.getInt();
+    uint32_t bits = r.getU32();
+    memcpy(&speedMultiplier, &bits, sizeof(bits));
+    carsPassed = r.getInt();
+    obstaclesAvoided = r.getInt();
+    frameCounter = r.getInt();
+}
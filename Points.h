@@ -9,6 +9,7 @@
 #define Points_h
 
 #include "Const.h"
+#include "State.h"
 
 class PointsManager {
 private:
@@ -99,6 +100,22 @@ public:
      * Post-condition: No state change
      */
     float getSpeedMultiplier() const { return speedMultiplier; }
+
+    /*
+     * Description: Append score and counters to a snapshot
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: State encoded into w
+     */
+    void save(StateWriter& w) const;
+
+    /*
+     * Description: Restore score and counters from a snapshot
+     * Return: void
+     * Pre-condition: r positioned at data written by save()
+     * Post-condition: State replaced, r advanced
+     */
+    void load(StateReader& r);
 };
 
 #endif /* Points_h */
@@ -0,0 +1,106 @@
+//================================================================
+// Policy.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Scripted Player Policies Implementation
+// Description: Idle, random and dodging automated drivers
+//================================================================
+
+#include "Policy.h"
+#include <cstdlib>
+
+// IDLE
+
+char IdlePolicy::decide(const Game& game) {
+    (void)game;
+    return '\0';
+}
+
+// RANDOM
+
+RandomPolicy::RandomPolicy(uint64_t seed) : _rng(seed ^ 0x5EEDF00DULL) {}
+
+char RandomPolicy::decide(const Game& game) {
+    (void)game;
+    switch(_rng.nextInt(20)) {
+        case 0:  return LEFT_ARROW;
+        case 1:  return RIGHT_ARROW;
+        case 2:  return UP_ARROW;
+        case 3:  return DOWN_ARROW;
+        default: return '\0';
+    }
+}
+
+// DODGE
+
+/*
+ * Description: Distance to the nearest car or cone ahead of a column
+ * Return: int - pixels of clear road, POLICY_LOOKAHEAD if none in range
+ * Pre-condition: x is a candidate player x position
+ * Post-condition: No state change
+ */
+static int clearance(const Game& game, int x) {
+    const PlayerCar& player = game.getPlayer();
+    int py = player.getLoc().y;
+    int half = player.getSize() / 2;
+    int nearest = POLICY_LOOKAHEAD;
+
+    const TrafficStore& traffic = game.getTraffic();
+    for(int i = 0; i < traffic.getCarCount(); i++) {
+        point a = traffic.getCarLoc(i);
+        int reach = half + traffic.getCarSize(i) / 2;
+        int dy = py - a.y;
+        if(dy > -reach && std::abs(a.x - x) < reach + POLICY_MARGIN) {
+            nearest = std::min(nearest, std::max(dy, 0));
+        }
+    }
+    for(int i = 0; i < traffic.getConeCount(); i++) {
+        point o = traffic.getConeLoc(i);
+        int reach = half + traffic.getConeSize(i) / 2;
+        int dy = py - o.y;
+        if(dy > -reach && std::abs(o.x - x) < reach + POLICY_MARGIN) {
+            nearest = std::min(nearest, std::max(dy, 0));
+        }
+    }
+    return nearest;
+}
+
+DodgePolicy::DodgePolicy() : _steer{'\0'} {}
+
+char DodgePolicy::decide(const Game& game) {
+    const PlayerCar& player = game.getPlayer();
+    int x = player.getLoc().x;
+    int half = player.getSize() / 2;
+
+    int stay = clearance(game, x);
+    if(stay >= POLICY_LOOKAHEAD) {
+        _steer = '\0';
+        return player.getSpeed() < POLICY_CRUISE_SPEED ? UP_ARROW : '\0';
+    }
+
+    // Compare one step left, one step right and staying put
+    int step = player.getSpeed();
+    bool roomLeft  = x > ROAD_START + half + ROAD_BOUNDARY_OFFSET;
+    bool roomRight = x < ROAD_END - half - ROAD_BOUNDARY_OFFSET;
+    int left  = roomLeft  ? clearance(game, x - step) : -1;
+    int right = roomRight ? clearance(game, x + step) : -1;
+
+    if(left != right && (left > stay || right > stay)) {
+        _steer = left > right ? LEFT_ARROW : RIGHT_ARROW;
+        return _steer;
+    }
+
+    // No side is better yet: commit to one direction until clear
+    if(_steer == LEFT_ARROW && !roomLeft)   _steer = RIGHT_ARROW;
+    if(_steer == RIGHT_ARROW && !roomRight) _steer = LEFT_ARROW;
+    if(_steer == '\0') _steer = x > CENTER_LANE_X ? LEFT_ARROW : RIGHT_ARROW;
+    return _steer;
+}
+
+// FACTORY
+
+std::unique_ptr<PlayerPolicy> makePolicy(const std::string& name, uint64_t seed) {
+    if(name == "idle")   return std::unique_ptr<PlayerPolicy>(new IdlePolicy());
+    if(name == "random") return std::unique_ptr<PlayerPolicy>(new RandomPolicy(seed));
+    if(name == "dodge")  return std::unique_ptr<PlayerPolicy>(new DodgePolicy());
+    return std::unique_ptr<PlayerPolicy>();
+}
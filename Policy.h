@@ -0,0 +1,106 @@
+//================================================================
+// Policy.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Scripted Player Policies
+// Description: Automated drivers that pick a key each tick
+//================================================================
+
+#ifndef Policy_h
+#define Policy_h
+
+#include "Game.h"
+#include "Random.h"
+#include <memory>
+#include <string>
+
+const int POLICY_LOOKAHEAD = 200;     // Pixels ahead the dodger watches
+const int POLICY_MARGIN = 6;          // Extra clearance when dodging
+const int POLICY_CRUISE_SPEED = 6;    // Speed the dodger accelerates to
+
+// BASE POLICY
+class PlayerPolicy {
+public:
+    /*
+     * Description: Virtual destructor
+     * Return: None (destructor)
+     * Pre-condition: None
+     * Post-condition: Derived policy cleaned up
+     */
+    virtual ~PlayerPolicy() {}
+
+    /*
+     * Description: Choose the key to press this tick
+     * Return: char - arrow constant, or '\0' for no input
+     * Pre-condition: game is in STATE_PLAYING
+     * Post-condition: Policy's own state may advance
+     */
+    virtual char decide(const Game& game) = 0;
+};
+
+// NEVER PRESSES ANYTHING
+class IdlePolicy : public PlayerPolicy {
+public:
+    /*
+     * Description: Never press anything (baseline for traffic alone)
+     * Return: char - key for this tick
+     * Pre-condition: game is in STATE_PLAYING
+     * Post-condition: No state change
+     */
+    char decide(const Game& game) override;
+};
+
+// PRESSES A RANDOM ARROW NOW AND THEN
+class RandomPolicy : public PlayerPolicy {
+private:
+    Random _rng;    // Own stream so the game's RNG is untouched
+
+public:
+    /*
+     * Description: Initialize random driver
+     * Return: None (constructor)
+     * Pre-condition: None
+     * Post-condition: Key choices fully determined by seed
+     */
+    explicit RandomPolicy(uint64_t seed);
+
+    /*
+     * Description: Press a random arrow on roughly one tick in five
+     * Return: char - key for this tick
+     * Pre-condition: game is in STATE_PLAYING
+     * Post-condition: _rng advanced
+     */
+    char decide(const Game& game) override;
+};
+
+// STEERS AWAY FROM THE NEAREST THREAT AHEAD
+class DodgePolicy : public PlayerPolicy {
+private:
+    char _steer;    // Direction committed to while boxed in
+
+public:
+    /*
+     * Description: Initialize dodging driver
+     * Return: None (constructor)
+     * Pre-condition: None
+     * Post-condition: No steering direction committed
+     */
+    DodgePolicy();
+
+    /*
+     * Description: Steer away from the closest car or cone ahead, else cruise
+     * Return: char - key for this tick
+     * Pre-condition: game is in STATE_PLAYING
+     * Post-condition: _steer updated
+     */
+    char decide(const Game& game) override;
+};
+
+/*
+ * Description: Build a policy by name ("idle", "random", "dodge")
+ * Return: unique_ptr<PlayerPolicy> - policy, null for unknown names
+ * Pre-condition: None
+ * Post-condition: New policy seeded from seed where applicable
+ */
+std::unique_ptr<PlayerPolicy> makePolicy(const std::string& name, uint64_t seed);
+
+#endif /* Policy_h */
@@ -0,0 +1,94 @@
+//================================================================
+// RaceEnv.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Reinforcement Learning Environment Implementation
+// Description: Actions, rewards and observations for training
+//================================================================
+
+#include "RaceEnv.h"
+
+// Key sent to Game::handleInput for each action
+static const char ACTION_KEYS[ACTION_COUNT] = {
+    '\0', LEFT_ARROW, RIGHT_ARROW, UP_ARROW, DOWN_ARROW
+};
+
+RaceEnv::RaceEnv(bool withPixels, int maxEpisodeSteps)
+    : game(0),
+      plotter{nullptr},
+      features{},
+      maxSteps{maxEpisodeSteps},
+      steps{0}
+{
+    if(withPixels) {
+        plotter = new SDL_Plotter(ROW, COL, false, PLOTTER_HEADLESS);
+    }
+}
+
+RaceEnv::~RaceEnv() {
+    delete plotter;
+}
+
+const float* RaceEnv::reset(uint64_t seed) {
+    game.reset(seed);
+    game.handleInput('S');
+    steps = 0;
+    observe();
+    return features;
+}
+
+StepResult RaceEnv::step(int action) {
+    StepResult result;
+    int before = game.getPoints().getScore();
+
+    if(action < 0 || action >= ACTION_COUNT) action = ACTION_NONE;
+    game.handleInput(ACTION_KEYS[action]);
+    game.tick();
+    steps++;
+
+    result.reward = static_cast<float>(game.getPoints().getScore() - before);
+    result.done = game.getState() != STATE_PLAYING;
+    result.truncated = !result.done && maxSteps > 0 && steps >= maxSteps;
+
+    // Game over only comes from Collision::checkAllCollisions
+    if(game.getState() == STATE_GAME_OVER) {
+        result.reward -= RACE_ENV_CRASH_PENALTY;
+    }
+
+    observe();
+    return result;
+}
+
+void RaceEnv::observe() {
+    const float sx = 1.0f / ROW;
+    const float sy = 1.0f / COL;
+    const float sv = 1.0f / MAX_SPEED;
+    float* f = features;
+
+    const PlayerCar& player = game.getPlayer();
+    *f++ = player.getLoc().x * sx;
+    *f++ = player.getLoc().y * sy;
+    *f++ = player.getSpeed() * sv;
+
+    // First entities in update order fill the slots
+    const TrafficStore& traffic = game.getTraffic();
+    for(int i = 0; i < RACE_ENV_AI_SLOTS; i++) {
+        bool used = i < traffic.getCarCount();
+        *f++ = used ? traffic.getCarLoc(i).x * sx : 0.0f;
+        *f++ = used ? traffic.getCarLoc(i).y * sy : 0.0f;
+        *f++ = used ? traffic.getCarSpeed(i) * sv : 0.0f;
+    }
+
+    for(int i = 0; i < RACE_ENV_OBSTACLE_SLOTS; i++) {
+        bool used = i < traffic.getConeCount();
+        *f++ = used ? traffic.getConeLoc(i).x * sx : 0.0f;
+        *f++ = used ? traffic.getConeLoc(i).y * sy : 0.0f;
+        *f++ = used ? 1.0f : 0.0f;
+    }
+}
+
+const Uint32* RaceEnv::render() {
+    if(!plotter) return nullptr;
+
+    game.draw(*plotter);
+    return plotter->getPixels();
+}
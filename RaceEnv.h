@@ -0,0 +1,116 @@
+//================================================================
+// RaceEnv.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Reinforcement Learning Environment
+// Description: reset/step interface around the racing state
+//================================================================
+
+#ifndef RaceEnv_h
+#define RaceEnv_h
+
+#include "Game.h"
+
+// ACTIONS - MAP ONTO PlayerCar::move
+enum RaceAction {
+    ACTION_NONE,
+    ACTION_LEFT,
+    ACTION_RIGHT,
+    ACTION_ACCELERATE,
+    ACTION_BRAKE,
+    ACTION_COUNT
+};
+
+// OBSERVATION LAYOUT: player (x, y, speed), then (x, y, speed) per AI
+// car slot, then (x, y, present) per obstacle slot. Positions are divided
+// by the screen size and speeds by MAX_SPEED; unused slots stay zero.
+const int   RACE_ENV_AI_SLOTS       = 3;
+const int   RACE_ENV_OBSTACLE_SLOTS = 3;
+const int   RACE_ENV_FEATURES       = 3 + 3 * RACE_ENV_AI_SLOTS + 3 * RACE_ENV_OBSTACLE_SLOTS;
+const float RACE_ENV_CRASH_PENALTY  = 100.0f;
+
+// Outcome of one step
+struct StepResult {
+    float reward;       // Score gained this step, minus crash penalty
+    bool  done;         // Race over (crash or win)
+    bool  truncated;    // Step limit reached before the race ended
+};
+
+class RaceEnv {
+private:
+    Game         game;                          // Simulated race
+    SDL_Plotter* plotter;                       // Headless target, only if rendering
+    float        features[RACE_ENV_FEATURES];   // Current observation
+    int          maxSteps;                      // Episode length cap, 0 = none
+    int          steps;                         // Steps this episode
+
+    /*
+     * Description: Refresh the feature vector from the game
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: features describe current entity positions
+     */
+    void observe();
+
+public:
+    /*
+     * Description: Initialize environment
+     * Return: None (constructor)
+     * Pre-condition: maxEpisodeSteps >= 0
+     * Post-condition: Env ready for reset(); framebuffer allocated only
+     *                 when withPixels is true
+     */
+    explicit RaceEnv(bool withPixels = false, int maxEpisodeSteps = 0);
+
+    /*
+     * Description: Release the headless plotter
+     * Return: None (destructor)
+     * Pre-condition: None
+     * Post-condition: Framebuffer freed
+     */
+    ~RaceEnv();
+
+    RaceEnv(const RaceEnv&) = delete;
+    RaceEnv& operator=(const RaceEnv&) = delete;
+
+    /*
+     * Description: Start a new race from a seed
+     * Return: const float* - RACE_ENV_FEATURES observation values
+     * Pre-condition: None
+     * Post-condition: Game in STATE_PLAYING at tick zero of the race
+     */
+    const float* reset(uint64_t seed);
+
+    /*
+     * Description: Apply an action and advance one tick
+     * Return: StepResult - reward and termination flags
+     * Pre-condition: reset() called, action < ACTION_COUNT
+     * Post-condition: Observation updated, no heap allocation
+     */
+    StepResult step(int action);
+
+    /*
+     * Description: Get the current feature vector
+     * Return: const float* - RACE_ENV_FEATURES values
+     * Pre-condition: reset() called
+     * Post-condition: No state change
+     */
+    const float* getObservation() const { return features; }
+
+    /*
+     * Description: Draw the current frame into the offscreen framebuffer
+     * Return: const Uint32* - ROW*COL packed RGB pixels, null without pixels
+     * Pre-condition: Env constructed with withPixels = true
+     * Post-condition: Framebuffer holds the frame the player would see
+     */
+    const Uint32* render();
+
+    /*
+     * Description: Get the simulated game
+     * Return: const Game& - game
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    const Game& getGame() const { return game; }
+};
+
+#endif /* RaceEnv_h */
@@ -0,0 +1,114 @@
+//================================================================
+// Random.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Random Number Generator
+// Description: Small seedable per-game generator (xoshiro128**)
+//================================================================
+
+#ifndef Random_h
+#define Random_h
+
+#include "State.h"
+#include <cstdint>
+
+class Random {
+private:
+    uint64_t _seed;     // Seed the generator was last started from
+    uint32_t _s[4];     // xoshiro128** state
+
+    static uint32_t rotl(uint32_t x, int k) {
+        return (x << k) | (x >> (32 - k));
+    }
+
+public:
+    /*
+     * Description: Initialize generator from a seed
+     * Return: None (constructor)
+     * Pre-condition: None
+     * Post-condition: State fully determined by seed
+     */
+    explicit Random(uint64_t seed = 0) { setSeed(seed); }
+
+    /*
+     * Description: Restart the sequence from a seed (splitmix64 expansion)
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: State reset, same seed always gives same sequence
+     */
+    void setSeed(uint64_t seed) {
+        _seed = seed;
+        uint64_t z = seed;
+        for(int i = 0; i < 4; i += 2) {
+            z += 0x9E3779B97F4A7C15ULL;
+            uint64_t x = z;
+            x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+            x ^= x >> 31;
+            _s[i]     = static_cast<uint32_t>(x);
+            _s[i + 1] = static_cast<uint32_t>(x >> 32);
+        }
+    }
+
+    /*
+     * Description: Get next raw 32-bit value
+     * Return: uint32_t - uniformly distributed bits
+     * Pre-condition: None
+     * Post-condition: State advanced one step
+     */
+    uint32_t next() {
+        uint32_t result = rotl(_s[1] * 5, 7) * 9;
+        uint32_t t = _s[1] << 9;
+
+        _s[2] ^= _s[0];
+        _s[3] ^= _s[1];
+        _s[1] ^= _s[2];
+        _s[0] ^= _s[3];
+        _s[2] ^= t;
+        _s[3] = rotl(_s[3], 11);
+
+        return result;
+    }
+
+    /*
+     * Description: Get integer in [0, n) (multiply-shift, no division)
+     * Return: int - value in range
+     * Pre-condition: n > 0
+     * Post-condition: State advanced one step
+     */
+    int nextInt(int n) {
+        return static_cast<int>((static_cast<uint64_t>(next()) *
+                                 static_cast<uint32_t>(n)) >> 32);
+    }
+
+    /*
+     * Description: Get seed the generator was started from
+     * Return: uint64_t - seed
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    uint64_t getSeed() const { return _seed; }
+
+    /*
+     * Description: Append seed and generator state to a snapshot
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: State encoded into w
+     */
+    void save(StateWriter& w) const {
+        w.putU64(_seed);
+        for(int i = 0; i < 4; i++) w.putU32(_s[i]);
+    }
+
+    /*
+     * Description: Restore seed and generator state from a snapshot
+     * Return: void
+     * Pre-condition: r positioned at data written by save()
+     * Post-condition: State replaced, r advanced
+     */
+    void load(StateReader& r) {
+        _seed = r.getU64();
+        for(int i = 0; i < 4; i++) _s[i] = r.getU32();
+    }
+};
+
+#endif /* Random_h */
@@ -0,0 +1,226 @@
+//================================================================
+// Replay.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Input Recording & Replay Implementation
+// Description: Varint-encoded input logs, keyframes, and playback
+//================================================================
+
+#include "Replay.h"
+#include <algorithm>
+#include <iterator>
+
+// RECORDER
+
+ReplayRecorder::ReplayRecorder()
+    : stopping{false},
+      recording{false},
+      lastTick{0}
+{}
+
+ReplayRecorder::~ReplayRecorder() {
+    if(isOpen()) close(lastTick);
+}
+
+bool ReplayRecorder::open(const std::string& path, uint64_t seed) {
+    file.open(path, std::ios::binary | std::ios::trunc);
+    if(!file.is_open()) return false;
+
+    std::vector<uint8_t> header(REPLAY_MAGIC, REPLAY_MAGIC + sizeof(REPLAY_MAGIC));
+    StateWriter w(header);
+    w.putByte(REPLAY_VERSION);
+    w.putU64(seed);
+    file.write(reinterpret_cast<const char*>(header.data()), header.size());
+
+    buffer.clear();
+    buffer.reserve(REPLAY_FLUSH_BYTES);
+    pending.clear();
+    stopping = false;
+    lastTick = 0;
+    recording = true;
+    writer = std::thread(&ReplayRecorder::writeLoop, this);
+    return true;
+}
+
+void ReplayRecorder::append(int tick, char key) {
+    StateWriter w(buffer);
+    w.putVarint(static_cast<uint32_t>(tick - lastTick));
+    w.putByte(static_cast<uint8_t>(key));
+    lastTick = tick;
+}
+
+void ReplayRecorder::record(int tick, char key) {
+    if(!isOpen() || key == REPLAY_END || key == REPLAY_KEYFRAME) return;
+
+    append(tick, key);
+    if(buffer.size() >= REPLAY_FLUSH_BYTES) flush();
+}
+
+void ReplayRecorder::recordKeyframe(const Game& game) {
+    if(!isOpen()) return;
+
+    std::vector<uint8_t> snapshot;
+    StateWriter s(snapshot);
+    game.save(s);
+
+    append(game.getTick(), REPLAY_KEYFRAME);
+    StateWriter w(buffer);
+    w.putVarint(static_cast<uint32_t>(snapshot.size()));
+    buffer.insert(buffer.end(), snapshot.begin(), snapshot.end());
+    if(buffer.size() >= REPLAY_FLUSH_BYTES) flush();
+}
+
+void ReplayRecorder::flush() {
+    {
+        std::lock_guard<std::mutex> lock(mut);
+        pending.insert(pending.end(), buffer.begin(), buffer.end());
+    }
+    buffer.clear();
+    cond.notify_one();
+}
+
+void ReplayRecorder::close(int endTick) {
+    if(!isOpen()) return;
+
+    append(endTick, REPLAY_END);
+    flush();
+    {
+        std::lock_guard<std::mutex> lock(mut);
+        stopping = true;
+    }
+    cond.notify_one();
+    writer.join();
+    file.close();
+    recording = false;
+}
+
+void ReplayRecorder::writeLoop() {
+    std::vector<uint8_t> chunk;
+    bool done = false;
+
+    while(!done) {
+        {
+            std::unique_lock<std::mutex> lock(mut);
+            cond.wait(lock, [this]{ return stopping || !pending.empty(); });
+            chunk.swap(pending);
+            done = stopping;
+        }
+        if(!chunk.empty()) {
+            file.write(reinterpret_cast<const char*>(chunk.data()), chunk.size());
+            chunk.clear();
+        }
+    }
+    file.flush();
+}
+
+// PLAYER
+
+ReplayPlayer::ReplayPlayer()
+    : seed{0},
+      endTick{0}
+{}
+
+bool ReplayPlayer::load(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    if(!in.is_open()) return false;
+
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(in)),
+                              std::istreambuf_iterator<char>());
+    StateReader r(data.data(), data.size());
+
+    for(size_t i = 0; i < sizeof(REPLAY_MAGIC); i++) {
+        if(r.getByte() != static_cast<uint8_t>(REPLAY_MAGIC[i])) return false;
+    }
+    uint8_t version = r.getByte();
+    if(version < 1 || version > REPLAY_VERSION) return false;
+    uint64_t fileSeed = r.getU64();
+    if(!r.good()) return false;
+
+    std::vector<ReplayEvent>    fileEvents;
+    std::vector<ReplayKeyframe> fileKeyframes;
+    std::vector<uint8_t>        fileSnapshots;
+    int tick = 0;
+    while(true) {
+        tick += static_cast<int>(r.getVarint());
+        char key = static_cast<char>(r.getByte());
+        if(!r.good()) return false;
+        if(key == REPLAY_END) break;
+
+        if(key == REPLAY_KEYFRAME) {
+            uint32_t size = r.getVarint();
+            size_t start = r.position();
+            r.skip(size);
+            if(!r.good()) return false;
+            if(version < REPLAY_VERSION) continue;
+
+            fileKeyframes.push_back(ReplayKeyframe{tick, fileSnapshots.size(), size});
+            fileSnapshots.insert(fileSnapshots.end(),
+                                 data.begin() + start, data.begin() + start + size);
+        } else {
+            fileEvents.push_back(ReplayEvent{tick, key});
+        }
+    }
+
+    seed = fileSeed;
+    events.swap(fileEvents);
+    keyframes.swap(fileKeyframes);
+    snapshots.swap(fileSnapshots);
+    endTick = tick;
+    return true;
+}
+
+void ReplayPlayer::advance(Game& game, size_t& next, int tick) const {
+    while(game.getTick() < tick) {
+        char key = '\0';
+        if(next < events.size() && events[next].tick == game.getTick()) {
+            key = events[next++].key;
+        }
+        game.handleInput(key);
+        game.tick();
+    }
+}
+
+bool ReplayPlayer::run(Game& game) const {
+    size_t next = 0;
+    std::vector<uint8_t> scratch;
+    bool inSync = true;
+
+    for(const ReplayKeyframe& k : keyframes) {
+        advance(game, next, k.tick);
+
+        scratch.clear();
+        StateWriter w(scratch);
+        game.save(w);
+        if(scratch.size() != k.size ||
+           !std::equal(scratch.begin(), scratch.end(), snapshots.begin() + k.offset)) {
+            inSync = false;
+        }
+    }
+    advance(game, next, endTick);
+    return inSync;
+}
+
+void ReplayPlayer::seek(Game& game, int tick) const {
+    tick = std::max(0, std::min(tick, endTick));
+
+    // Last keyframe at or before the target
+    std::vector<ReplayKeyframe>::const_iterator kf =
+        std::upper_bound(keyframes.begin(), keyframes.end(), tick,
+                         [](int t, const ReplayKeyframe& k){ return t < k.tick; });
+    int base = (kf == keyframes.begin()) ? 0 : std::prev(kf)->tick;
+
+    // Already between that keyframe and the target: just simulate forward
+    if(game.getTick() > tick || game.getTick() < base) {
+        bool restored = false;
+        if(kf != keyframes.begin()) {
+            const ReplayKeyframe& k = *std::prev(kf);
+            StateReader r(snapshots.data() + k.offset, k.size);
+            restored = game.load(r);
+        }
+        if(!restored) game.reset(seed);
+    }
+
+    size_t next = std::lower_bound(events.begin(), events.end(), game.getTick(),
+                                   [](const ReplayEvent& e, int t){ return e.tick < t; })
+                  - events.begin();
+    advance(game, next, tick);
+}
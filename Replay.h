@@ -0,0 +1,230 @@
+//================================================================
+// Replay.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Input Recording & Replay
+// Description: Compact binary input logs and max-speed playback
+//================================================================
+
+#ifndef Replay_h
+#define Replay_h
+
+#include "Game.h"
+#include "State.h"
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+// FILE FORMAT
+//   header : "PXRP", version byte, seed (8 bytes, little endian)
+//   record : varint tick delta since previous record, key byte
+// A record with key REPLAY_END closes the session at its tick. A record
+// with key REPLAY_KEYFRAME (version 2) is followed by a varint length and
+// a Game::save() snapshot taken before that tick's input was applied.
+// Version 3 snapshots no longer carry a cone active flag; keyframes of
+// older files are skipped, so those replay from the seed.
+const char     REPLAY_MAGIC[4]    = {'P', 'X', 'R', 'P'};
+const uint8_t  REPLAY_VERSION     = 3;
+const char     REPLAY_END         = '\0';
+const char     REPLAY_KEYFRAME    = 0x7F;
+const int      REPLAY_KEYFRAME_INTERVAL = 300;
+const size_t   REPLAY_FLUSH_BYTES = 4096;
+
+// One consumed key press
+struct ReplayEvent {
+    int  tick;  // Game tick the key was applied on
+    char key;   // Key as passed to Game::handleInput
+};
+
+// Seek index entry for one stored snapshot
+struct ReplayKeyframe {
+    int    tick;        // Tick the snapshot was taken on
+    size_t offset;      // Snapshot start in ReplayPlayer::snapshots
+    size_t size;        // Snapshot length in bytes
+};
+
+// RECORDER - WRITES ON A BACKGROUND THREAD
+class ReplayRecorder {
+private:
+    std::ofstream           file;       // Output log
+    std::vector<uint8_t>    buffer;     // Records not yet handed to writer
+    std::vector<uint8_t>    pending;    // Records waiting on writer thread
+    std::thread             writer;     // Drains pending into file
+    std::mutex              mut;
+    std::condition_variable cond;
+    bool                    stopping;   // Writer should drain and exit
+    bool                    recording;  // Between open() and close(); only
+                                        // the owning thread touches it
+    int                     lastTick;   // Tick of previous record
+
+    /*
+     * Description: Append one record to the local buffer
+     * Return: void
+     * Pre-condition: tick >= lastTick
+     * Post-condition: Record encoded, lastTick updated
+     */
+    void append(int tick, char key);
+
+    /*
+     * Description: Hand buffered records to the writer thread
+     * Return: void
+     * Pre-condition: Recorder is open
+     * Post-condition: buffer empty, writer signalled
+     */
+    void flush();
+
+    /*
+     * Description: Writer thread body
+     * Return: void
+     * Pre-condition: Started by open()
+     * Post-condition: All pending bytes written when stopping is set
+     */
+    void writeLoop();
+
+public:
+    /*
+     * Description: Initialize closed recorder
+     * Return: None (constructor)
+     * Pre-condition: None
+     * Post-condition: Recorder created, nothing recorded
+     */
+    ReplayRecorder();
+
+    /*
+     * Description: Close the log if still open
+     * Return: None (destructor)
+     * Pre-condition: None
+     * Post-condition: Writer joined, file closed
+     */
+    ~ReplayRecorder();
+
+    /*
+     * Description: Start a new log and write its header
+     * Return: bool - false if the file could not be created
+     * Pre-condition: Recorder not already open
+     * Post-condition: Writer thread running
+     */
+    bool open(const std::string& path, uint64_t seed);
+
+    /*
+     * Description: Record a key consumed by the game loop
+     * Return: void
+     * Pre-condition: tick is the game tick the key is applied on
+     * Post-condition: Record buffered; never blocks on disk
+     */
+    void record(int tick, char key);
+
+    /*
+     * Description: Store a full game snapshot for seeking
+     * Return: void
+     * Pre-condition: Called before the input for game.getTick() is recorded
+     * Post-condition: Keyframe buffered; never blocks on disk
+     */
+    void recordKeyframe(const Game& game);
+
+    /*
+     * Description: Write end marker, flush and stop the writer
+     * Return: void
+     * Pre-condition: endTick is the number of ticks the session ran
+     * Post-condition: Log complete on disk, recorder closed
+     */
+    void close(int endTick);
+
+    /*
+     * Description: Check if recorder is writing a log
+     * Return: bool - true if open
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    bool isOpen() const { return recording; }
+};
+
+// PLAYER - FEEDS A LOG BACK THROUGH THE STATE MACHINE
+class ReplayPlayer {
+private:
+    uint64_t                    seed;       // Game seed from header
+    std::vector<ReplayEvent>    events;     // Inputs in tick order
+    std::vector<ReplayKeyframe> keyframes;  // Seek index, in tick order
+    std::vector<uint8_t>        snapshots;  // Keyframe bytes back to back
+    int                         endTick;    // Tick the session ended on
+
+    /*
+     * Description: Simulate recorded inputs up to a tick
+     * Return: void
+     * Pre-condition: next is the first event at or after game.getTick()
+     * Post-condition: game.getTick() == tick, next past applied events
+     */
+    void advance(Game& game, size_t& next, int tick) const;
+
+public:
+    /*
+     * Description: Initialize empty player
+     * Return: None (constructor)
+     * Pre-condition: None
+     * Post-condition: No log loaded
+     */
+    ReplayPlayer();
+
+    /*
+     * Description: Load and decode a replay log
+     * Return: bool - false if missing, truncated or wrong format
+     * Pre-condition: None
+     * Post-condition: seed, events and endTick replaced on success
+     */
+    bool load(const std::string& path);
+
+    /*
+     * Description: Play every input at full speed without rendering,
+     *              checking the simulation against each stored keyframe
+     * Return: bool - false if the game diverged from a keyframe
+     * Pre-condition: game freshly constructed with getSeed()
+     * Post-condition: game advanced to getEndTick()
+     */
+    bool run(Game& game) const;
+
+    /*
+     * Description: Jump to a tick by restoring the nearest earlier keyframe
+     *              and simulating only the remaining ticks
+     * Return: void
+     * Pre-condition: game constructed with getSeed(), only driven by this player
+     * Post-condition: game.getTick() == tick (clamped to [0, getEndTick()])
+     */
+    void seek(Game& game, int tick) const;
+
+    /*
+     * Description: Get seed the recorded game used
+     * Return: uint64_t - seed
+     * Pre-condition: Log loaded
+     * Post-condition: No state change
+     */
+    uint64_t getSeed() const { return seed; }
+
+    /*
+     * Description: Get tick the recorded session ended on
+     * Return: int - end tick
+     * Pre-condition: Log loaded
+     * Post-condition: No state change
+     */
+    int getEndTick() const { return endTick; }
+
+    /*
+     * Description: Get number of recorded inputs
+     * Return: size_t - event count
+     * Pre-condition: Log loaded
+     * Post-condition: No state change
+     */
+    size_t getEventCount() const { return events.size(); }
+
+    /*
+     * Description: Get number of stored keyframes
+     * Return: size_t - keyframe count
+     * Pre-condition: Log loaded
+     * Post-condition: No state change
+     */
+    size_t getKeyframeCount() const { return keyframes.size(); }
+};
+
+#endif /* Replay_h */
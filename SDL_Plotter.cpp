@@ -1,6 +1,46 @@
 /*
  * SDL_Plotter.h
  *
+ * Version 4.1
+ * Add: drawable row bounds
+ * 10/17/2026
+ *
+ * Version 4.0
+ * Add: band views, for drawing one frame from several threads
+ * 10/17/2026
+ *
+ * Version 3.9
+ * Add: run-length image blit
+ * 10/17/2026
+ *
+ * Version 3.8
+ * Add: bitmask blit
+ * 10/17/2026
+ *
+ * Version 3.7
+ * Add: streaming texture mode drawing straight into locked texture memory
+ * 10/17/2026
+ *
+ * Version 3.6
+ * Add: damage tracking, partial texture upload, incremental frames
+ * 10/17/2026
+ *
+ * Version 3.5
+ * Add: blitRows for copying prebuilt full-width rows
+ * 10/17/2026
+ *
+ * Version 3.4
+ * Add: SSE2/AVX2 fill kernels with runtime dispatch, clear to color
+ * 10/17/2026
+ *
+ * Version 3.3
+ * Add: clipped span fills (hline, vline, fillRect, fillRows)
+ * 10/17/2026
+ *
+ * Version 3.2
+ * Add: headless offscreen mode with injectable input
+ * 10/17/2026
+ *
  * Version 3.0
  * 5/20/2022
  *
@@ -17,6 +57,13 @@
  */
 
 #include "SDL_Plotter.h"
+#include <algorithm>
+#include <stdint.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define PLOTTER_X86_SIMD 1
+#include <immintrin.h>
+#endif
 
 //Threaded Sound Function
 
@@ -43,13 +90,33 @@ static int Sound(void *data){
 
 // SDL Plotter Function Definitions
 
-SDL_Plotter::SDL_Plotter(int r, int c, bool WITH_SOUND){
+SDL_Plotter::SDL_Plotter(int r, int c, bool WITH_SOUND, PlotterMode MODE){
     row = r;
     col = c;
+    top    = 0;
+    bottom = row;
     //leftMouseButtonDown = false;
     quit = false;
-    SOUND = WITH_SOUND;
+    mode = MODE;
+    SOUND = WITH_SOUND && mode != PLOTTER_HEADLESS;
     currentKeyStates = NULL;
+    soundCount = 0;
+    texture  = nullptr;
+    renderer = nullptr;
+    window   = nullptr;
+    dirtyCount    = 0;
+    incremental   = false;
+    bytesUploaded = 0;
+
+    buffer   = new Uint32[col * row];
+    pixels   = buffer;
+    pitch    = col;
+
+    memset(pixels, WHITE, col * row * sizeof(Uint32));
+    markDirty(0, 0, col, row);
+
+    //Headless: framebuffer only, never touch a display or audio device
+    if(mode == PLOTTER_HEADLESS) return;
 
     SDL_Init(SDL_INIT_AUDIO);
 
@@ -59,25 +126,72 @@ SDL_Plotter::SDL_Plotter(int r, int c, bool WITH_SOUND){
 
     renderer = SDL_CreateRenderer(window, -1, 0);
 
-    texture  = SDL_CreateTexture(renderer,
-                                 SDL_PIXELFORMAT_ARGB8888,
-                                 SDL_TEXTUREACCESS_STATIC, col, row);
-
-    pixels   = new Uint32[col * row];
-
-    memset(pixels, WHITE, col * row * sizeof(Uint32));
+    //Streaming: draw into the texture itself, no per-frame copy
+    if(mode == PLOTTER_STREAMING){
+        texture = SDL_CreateTexture(renderer,
+                                    SDL_PIXELFORMAT_ARGB8888,
+                                    SDL_TEXTUREACCESS_STREAMING, col, row);
+        if(texture && lockStreaming()){
+            clear();
+        }
+        else{
+            fallbackToStatic();
+        }
+    }
+    else{
+        texture  = SDL_CreateTexture(renderer,
+                                     SDL_PIXELFORMAT_ARGB8888,
+                                     SDL_TEXTUREACCESS_STATIC, col, row);
+    }
 
     currentKeyStates = SDL_GetKeyboardState( NULL );
 
     //SOUND Thread Pool
     Mix_OpenAudio( 44100, MIX_DEFAULT_FORMAT, 2, 2048 );
-    soundCount = 0;
     update();
   }
 
 
+SDL_Plotter::SDL_Plotter(SDL_Plotter& parent, int bandTop, int bandBottom){
+    quit = false;
+    mode = PLOTTER_HEADLESS;
+    SOUND = false;
+    currentKeyStates = NULL;
+    soundCount = 0;
+    texture  = nullptr;
+    renderer = nullptr;
+    window   = nullptr;
+    buffer   = nullptr;
+    bytesUploaded = 0;
+
+    bindBand(parent, bandTop, bandBottom);
+}
+
+void SDL_Plotter::bindBand(SDL_Plotter& parent, int bandTop, int bandBottom){
+    row    = parent.row;
+    col    = parent.col;
+    pixels = parent.pixels;
+    pitch  = parent.pitch;
+    top    = max(bandTop, 0);
+    bottom = min(bandBottom, row);
+    incremental = parent.incremental;
+    dirtyCount  = 0;
+}
+
+void SDL_Plotter::mergeBand(SDL_Plotter& band){
+    for(int i = 0; i < band.dirtyCount; i++){
+        const SDL_Rect& r = band.dirty[i];
+        addDirty(r.x, r.y, r.x + r.w, r.y + r.h);
+    }
+    band.dirtyCount = 0;
+}
+
+
 SDL_Plotter::~SDL_Plotter(){
-    delete[] pixels;
+    delete[] buffer;
+    if(mode == PLOTTER_HEADLESS) return;
+
+    if(mode == PLOTTER_STREAMING) SDL_UnlockTexture(texture);
     SDL_DestroyTexture(texture);
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
@@ -85,19 +199,82 @@ SDL_Plotter::~SDL_Plotter(){
 
 }
 
+bool SDL_Plotter::lockStreaming(){
+    void* target = nullptr;
+    int   bytes  = 0;
+    if(SDL_LockTexture(texture, NULL, &target, &bytes) != 0) return false;
+    pixels = (Uint32*)target;
+    pitch  = bytes / (int)sizeof(Uint32);
+    return true;
+}
+
+void SDL_Plotter::fallbackToStatic(){
+    if(texture) SDL_DestroyTexture(texture);
+    texture = SDL_CreateTexture(renderer,
+                                SDL_PIXELFORMAT_ARGB8888,
+                                SDL_TEXTUREACCESS_STATIC, col, row);
+    mode   = PLOTTER_WINDOW;
+    pixels = buffer;
+    pitch  = col;
+    dirtyCount = 0;
+    markDirty(0, 0, col, row);
+}
+
 void SDL_Plotter::update(){
-    SDL_UpdateTexture(texture, NULL, pixels, col * sizeof(Uint32));
+    //Streaming: the frame is already in the texture, hand it back
+    if(mode == PLOTTER_STREAMING){
+        SDL_UnlockTexture(texture);
+        bytesUploaded = (size_t)col * row * sizeof(Uint32);
+        dirtyCount = 0;
+
+        SDL_RenderClear(renderer);
+        SDL_RenderCopy(renderer, texture, NULL, NULL);
+        SDL_RenderPresent(renderer);
+
+        //Lock right away so drawing always has a target
+        if(!lockStreaming()) fallbackToStatic();
+        return;
+    }
+
+    //Upload only the damaged rectangles; the texture keeps the rest
+    bytesUploaded = 0;
+    for(int i = 0; i < dirtyCount; i++){
+        const SDL_Rect& r = dirty[i];
+        bytesUploaded += (size_t)r.w * r.h * sizeof(Uint32);
+        if(mode != PLOTTER_HEADLESS){
+            SDL_UpdateTexture(texture, &r, pixels + r.y * pitch + r.x, pitch * sizeof(Uint32));
+        }
+    }
+    dirtyCount = 0;
+
+    if(mode == PLOTTER_HEADLESS) return;
+
     SDL_RenderClear(renderer);
     SDL_RenderCopy(renderer, texture, NULL, NULL);
     SDL_RenderPresent(renderer);
 }
 
 Uint32 SDL_Plotter::getColor(int x, int y){
-    return pixels[y * col + x];
+    return pixels[y * pitch + x];
+}
+
+const Uint32* SDL_Plotter::getPixels(){
+    return pixels;
+}
+
+int SDL_Plotter::getPitch(){
+    return pitch;
+}
+
+PlotterMode SDL_Plotter::getMode(){
+    return mode;
 }
 
 
 bool SDL_Plotter::getQuit(){
+    //Headless input arrives through pushKey/pushMouseClick instead
+    if(mode == PLOTTER_HEADLESS) return quit;
+
     //Handle events on queue
     while( SDL_PollEvent( &event ) != 0 )
     {
@@ -164,6 +341,18 @@ point SDL_Plotter::getMouseClick(){
     return p;
 }
 
+void SDL_Plotter::pushKey(char key){
+    key_queue.push(key);
+}
+
+void SDL_Plotter::pushMouseClick(point p){
+    click_queue.push(p);
+}
+
+bool SDL_Plotter::isHeadless(){
+    return mode == PLOTTER_HEADLESS;
+}
+
 
 void SDL_Plotter::plotPixel(point p, int r, int g, int b){
     plotPixel(p.x,  p.y,  r,  g,  b);
@@ -179,13 +368,314 @@ void SDL_Plotter::plotPixel(point p, color c){
 
 
 void SDL_Plotter::plotPixel(int x, int y, int r, int g, int b){
-    if(x >= 0 && y >= 0 && x < col && y < row){
-        pixels[y * col + x] = RED_SHIFT*r + GREEN_SHIFT*g + BLUE_SHIFT*b;
+    if(x >= 0 && y >= top && x < col && y < bottom){
+        pixels[y * pitch + x] = RED_SHIFT*r + GREEN_SHIFT*g + BLUE_SHIFT*b;
+        addDirty(x, y, x + 1, y + 1);
+    }
+}
+
+//Damage tracking
+
+static inline int rectArea(int x0, int y0, int x1, int y1){
+    return (x1 - x0) * (y1 - y0);
+}
+
+void SDL_Plotter::addDirty(int x0, int y0, int x1, int y1){
+    //Already covered (whole frame, or the same glyph as the last call)
+    for(int i = dirtyCount - 1; i >= 0 && i >= dirtyCount - 2; i--){
+        const SDL_Rect& r = dirty[i];
+        if(x0 >= r.x && y0 >= r.y && x1 <= r.x + r.w && y1 <= r.y + r.h) return;
+    }
+
+    //Absorb every rectangle this one touches, repeating as it grows
+    bool merged = true;
+    while(merged){
+        merged = false;
+        for(int i = 0; i < dirtyCount; i++){
+            const SDL_Rect& r = dirty[i];
+            if(x0 <= r.x + r.w && r.x <= x1 && y0 <= r.y + r.h && r.y <= y1){
+                x0 = min(x0, r.x);           y0 = min(y0, r.y);
+                x1 = max(x1, r.x + r.w);     y1 = max(y1, r.y + r.h);
+                dirty[i] = dirty[--dirtyCount];
+                merged = true;
+                break;
+            }
+        }
+    }
+
+    //Full: fold into the rectangle that grows the least
+    if(dirtyCount == MAX_DIRTY_RECTS){
+        int best = 0, bestGrowth = -1;
+        for(int i = 0; i < dirtyCount; i++){
+            const SDL_Rect& r = dirty[i];
+            int growth = rectArea(min(x0, r.x), min(y0, r.y),
+                                  max(x1, r.x + r.w), max(y1, r.y + r.h))
+                       - r.w * r.h;
+            if(bestGrowth < 0 || growth < bestGrowth){
+                best = i;
+                bestGrowth = growth;
+            }
+        }
+        const SDL_Rect r = dirty[best];
+        dirty[best] = dirty[--dirtyCount];
+        addDirty(min(x0, r.x), min(y0, r.y), max(x1, r.x + r.w), max(y1, r.y + r.h));
+        return;
+    }
+
+    SDL_Rect& r = dirty[dirtyCount++];
+    r.x = x0;
+    r.y = y0;
+    r.w = x1 - x0;
+    r.h = y1 - y0;
+}
+
+void SDL_Plotter::markDirty(int x, int y, int w, int h){
+    int x0 = max(x, 0),   x1 = min(x + w, col);
+    int y0 = max(y, top), y1 = min(y + h, bottom);
+    if(x0 < x1 && y0 < y1) addDirty(x0, y0, x1, y1);
+}
+
+void SDL_Plotter::setIncremental(bool flag){
+    incremental = flag && mode != PLOTTER_STREAMING;
+}
+
+bool SDL_Plotter::isIncremental(){
+    return incremental;
+}
+
+size_t SDL_Plotter::getBytesUploaded(){
+    return bytesUploaded;
+}
+
+//Fill kernels: store one packed color n times
+
+typedef void (*FillKernel)(Uint32* dst, size_t n, Uint32 value);
+
+static void fillScalar(Uint32* dst, size_t n, Uint32 value){
+    for(size_t i = 0; i < n; i++){
+        dst[i] = value;
+    }
+}
+
+#ifdef PLOTTER_X86_SIMD
+__attribute__((target("sse2")))
+static void fillSSE2(Uint32* dst, size_t n, Uint32 value){
+    __m128i v = _mm_set1_epi32((int)value);
+    while(n > 0 && ((uintptr_t)dst & 15)){ *dst++ = value; n--; }
+    for(; n >= 16; n -= 16, dst += 16){
+        _mm_store_si128((__m128i*)(dst),      v);
+        _mm_store_si128((__m128i*)(dst + 4),  v);
+        _mm_store_si128((__m128i*)(dst + 8),  v);
+        _mm_store_si128((__m128i*)(dst + 12), v);
+    }
+    for(; n >= 4; n -= 4, dst += 4){
+        _mm_store_si128((__m128i*)dst, v);
+    }
+    while(n--) *dst++ = value;
+}
+
+__attribute__((target("avx2")))
+static void fillAVX2(Uint32* dst, size_t n, Uint32 value){
+    __m256i v = _mm256_set1_epi32((int)value);
+    while(n > 0 && ((uintptr_t)dst & 31)){ *dst++ = value; n--; }
+    for(; n >= 32; n -= 32, dst += 32){
+        _mm256_store_si256((__m256i*)(dst),      v);
+        _mm256_store_si256((__m256i*)(dst + 8),  v);
+        _mm256_store_si256((__m256i*)(dst + 16), v);
+        _mm256_store_si256((__m256i*)(dst + 24), v);
+    }
+    for(; n >= 8; n -= 8, dst += 8){
+        _mm256_store_si256((__m256i*)dst, v);
+    }
+    while(n--) *dst++ = value;
+}
+#endif
+
+static const FillKernel FILL_KERNELS[] = {
+    fillScalar,
+#ifdef PLOTTER_X86_SIMD
+    fillSSE2,
+    fillAVX2
+#else
+    fillScalar,
+    fillScalar
+#endif
+};
+
+static bool fillKernelSupported(FillKernelType type){
+#ifdef PLOTTER_X86_SIMD
+    __builtin_cpu_init();
+    switch(type){
+        case FILL_SCALAR: return true;
+        case FILL_SSE2:   return __builtin_cpu_supports("sse2");
+        case FILL_AVX2:   return __builtin_cpu_supports("avx2");
+    }
+    return false;
+#else
+    return type == FILL_SCALAR;
+#endif
+}
+
+static FillKernelType bestFillKernel(){
+    if(fillKernelSupported(FILL_AVX2)) return FILL_AVX2;
+    if(fillKernelSupported(FILL_SSE2)) return FILL_SSE2;
+    return FILL_SCALAR;
+}
+
+static FillKernelType fillKernelType = bestFillKernel();
+static FillKernel     fillKernel     = FILL_KERNELS[fillKernelType];
+
+//Short spans (font strokes, lane dashes) are cheaper without the call
+static inline void fillSpan(Uint32* dst, size_t n, Uint32 value){
+    if(n < 16){
+        while(n--) *dst++ = value;
+    }
+    else{
+        fillKernel(dst, n, value);
+    }
+}
+
+FillKernelType SDL_Plotter::getFillKernel(){
+    return fillKernelType;
+}
+
+bool SDL_Plotter::setFillKernel(FillKernelType type){
+    if(!fillKernelSupported(type)) return false;
+    fillKernelType = type;
+    fillKernel = FILL_KERNELS[type];
+    return true;
+}
+
+//Span fills
+
+static inline Uint32 packColor(const color& c){
+    return RED_SHIFT*c.R + GREEN_SHIFT*c.G + BLUE_SHIFT*c.B;
+}
+
+void SDL_Plotter::hline(int x, int y, int length, color c){
+    if(y < top || y >= bottom) return;
+    int x0 = max(x, 0);
+    int x1 = min(x + length, col);
+    if(x0 >= x1) return;
+    fillSpan(pixels + y * pitch + x0, x1 - x0, packColor(c));
+    addDirty(x0, y, x1, y + 1);
+}
+
+void SDL_Plotter::vline(int x, int y, int length, color c){
+    if(x < 0 || x >= col) return;
+    int y0 = max(y, top);
+    int y1 = min(y + length, bottom);
+    if(y0 >= y1) return;
+    addDirty(x, y0, x + 1, y1);
+    Uint32 packed = packColor(c);
+    for(Uint32* p = pixels + y0 * pitch + x; y0 < y1; y0++, p += pitch){
+        *p = packed;
+    }
+}
+
+void SDL_Plotter::fillPacked(int x, int y, int width, int height, Uint32 packed){
+    int x0 = max(x, 0), x1 = min(x + width, col);
+    int y0 = max(y, top), y1 = min(y + height, bottom);
+    if(x0 >= x1 || y0 >= y1) return;
+    addDirty(x0, y0, x1, y1);
+    if(x0 == 0 && x1 == col && pitch == col){
+        fillSpan(pixels + y0 * col, (size_t)(y1 - y0) * col, packed);
+        return;
+    }
+    for(; y0 < y1; y0++){
+        fillSpan(pixels + y0 * pitch + x0, x1 - x0, packed);
+    }
+}
+
+void SDL_Plotter::fillRect(int x, int y, int width, int height, color c){
+    fillPacked(x, y, width, height, packColor(c));
+}
+
+void SDL_Plotter::fillRows(int y, int height, color c){
+    fillRect(0, y, col, height, c);
+}
+
+void SDL_Plotter::blitRows(int y, int height, const Uint32* src){
+    int y0 = max(y, top);
+    int y1 = min(y + height, bottom);
+    if(y0 >= y1) return;
+    src += (size_t)(y0 - y) * col;
+    if(pitch == col){
+        memcpy(pixels + y0 * col, src, (size_t)(y1 - y0) * col * sizeof(Uint32));
+    }
+    else{
+        for(int yy = y0; yy < y1; yy++, src += col){
+            memcpy(pixels + yy * pitch, src, col * sizeof(Uint32));
+        }
+    }
+    addDirty(0, y0, col, y1);
+}
+
+//Index of the lowest set bit, bits nonzero
+static inline int lowestBit(Uint32 bits){
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(bits);
+#else
+    int i = 0;
+    while(!(bits & 1)){ bits >>= 1; i++; }
+    return i;
+#endif
+}
+
+void SDL_Plotter::blitMask(int x, int y, int width, int height, const Uint32* rows, color c){
+    int x0 = max(x, 0), x1 = min(x + width, col);
+    int y0 = max(y, top), y1 = min(y + height, bottom);
+    if(x0 >= x1 || y0 >= y1) return;
+    addDirty(x0, y0, x1, y1);
+    Uint32 packed = packColor(c);
+
+    //Drop the columns that fall off either side of the screen
+    Uint32 keep = (x1 - x < 32) ? (1u << (x1 - x)) - 1 : 0xFFFFFFFF;
+    keep &= ~((1u << (x0 - x)) - 1);
+    for(; y0 < y1; y0++){
+        Uint32* line = pixels + y0 * pitch + x0;
+        Uint32 bits = (rows[y0 - y] & keep) >> (x0 - x);
+
+        //One run of set bits at a time
+        while(bits != 0){
+            int start = lowestBit(bits);
+            bits >>= start;
+            line += start;
+            int length = (~bits == 0) ? 32 : lowestBit(~bits);
+            for(int i = 0; i < length; i++) line[i] = packed;
+            line += length;
+            bits = (length < 32) ? bits >> length : 0;
+        }
+    }
+}
+
+void SDL_Plotter::blitRuns(int x, int y, int width, int height, const Uint32* image,
+                           const ImageRun* runs, int count){
+    int x0 = max(x, 0), x1 = min(x + width, col);
+    int y0 = max(y, top), y1 = min(y + height, bottom);
+    if(x0 >= x1 || y0 >= y1) return;
+    addDirty(x0, y0, x1, y1);
+
+    for(int i = 0; i < count; i++){
+        const ImageRun& r = runs[i];
+        int py = y + r.y;
+        if(py < y0) continue;
+        if(py >= y1) break;
+        int a = max(x + r.x, x0);
+        int b = min(x + r.x + r.length, x1);
+        if(a >= b) continue;
+        memcpy(pixels + py * pitch + a, image + r.y * width + (a - x), (b - a) * sizeof(Uint32));
     }
 }
 
 void SDL_Plotter::clear(){
-         memset(pixels, WHITE, col * row * sizeof(Uint32));
+    if(incremental) return;
+    fillPacked(0, 0, col, row, CLEAR_PIXEL);
+}
+
+void SDL_Plotter::clear(color c){
+    if(incremental) return;
+    fillPacked(0, 0, col, row, packColor(c));
 }
 
 int SDL_Plotter::getRow(){
@@ -196,7 +686,16 @@ int SDL_Plotter::getCol(){
     return col;
 }
 
+int SDL_Plotter::getTop(){
+    return top;
+}
+
+int SDL_Plotter::getBottom(){
+    return bottom;
+}
+
 void SDL_Plotter::initSound(string sound){
+    if(mode == PLOTTER_HEADLESS) return;
     if(!soundMap[sound].running){
             param* p = &soundMap[sound];
             p->name = sound;
@@ -212,17 +711,20 @@ void SDL_Plotter::setQuit(bool flag){
 }
 
 void SDL_Plotter::playSound(string sound){
+    if(mode == PLOTTER_HEADLESS) return;
     if(soundMap[sound].running){
         SDL_CondSignal(soundMap[sound].cond);
     }
 }
 
 void SDL_Plotter::quitSound(string sound){
+    if(mode == PLOTTER_HEADLESS) return;
     soundMap[sound].running = false;
     SDL_CondSignal(soundMap[sound].cond);
 }
 
 void SDL_Plotter::Sleep(int ms){
+    if(mode == PLOTTER_HEADLESS) return;
     SDL_Delay(ms);
 }
 
@@ -230,6 +732,7 @@ void SDL_Plotter::Sleep(int ms){
 bool SDL_Plotter::getMouseDown(int& x, int& y){
         bool flag = false;
         x = y = 0;
+        if(mode == PLOTTER_HEADLESS) return flag;
         if(SDL_PollEvent(&event)){
             if(event.type == SDL_MOUSEBUTTONDOWN){
                 //Get mouse position
@@ -246,6 +749,7 @@ bool SDL_Plotter::getMouseDown(int& x, int& y){
 bool SDL_Plotter::getMouseUp(int& x, int& y){
         bool flag = false;
         x = y = 0;
+        if(mode == PLOTTER_HEADLESS) return flag;
         if(SDL_PollEvent(&event)){
             if(event.type == SDL_MOUSEBUTTONUP){
                 //Get mouse position
@@ -262,6 +766,7 @@ bool SDL_Plotter::getMouseUp(int& x, int& y){
 bool SDL_Plotter::getMouseMotion(int& x, int& y){
         bool flag = false;
         x = y = 0;
+        if(mode == PLOTTER_HEADLESS) return flag;
         if(SDL_PollEvent(&event)){
             if(event.type == SDL_MOUSEMOTION){
                 //Get mouse position
@@ -276,6 +781,10 @@ bool SDL_Plotter::getMouseMotion(int& x, int& y){
 }
 
 void SDL_Plotter::getMouseLocation(int& x, int& y){
+    if(mode == PLOTTER_HEADLESS){
+        x = y = 0;
+        return;
+    }
     SDL_GetMouseState( &x, &y );
     cout << x << " " << y << endl;
 }
@@ -1,6 +1,46 @@
 /*
  * SDL_Plotter.h
  *
+ * Version 4.1
+ * Add: drawable row bounds
+ * 10/17/2026
+ *
+ * Version 4.0
+ * Add: band views, for drawing one frame from several threads
+ * 10/17/2026
+ *
+ * Version 3.9
+ * Add: run-length image blit
+ * 10/17/2026
+ *
+ * Version 3.8
+ * Add: bitmask blit
+ * 10/17/2026
+ *
+ * Version 3.7
+ * Add: streaming texture mode drawing straight into locked texture memory
+ * 10/17/2026
+ *
+ * Version 3.6
+ * Add: damage tracking, partial texture upload, incremental frames
+ * 10/17/2026
+ *
+ * Version 3.5
+ * Add: blitRows for copying prebuilt full-width rows
+ * 10/17/2026
+ *
+ * Version 3.4
+ * Add: SSE2/AVX2 fill kernels with runtime dispatch, clear to color
+ * 10/17/2026
+ *
+ * Version 3.3
+ * Add: clipped span fills (hline, vline, fillRect, fillRows)
+ * 10/17/2026
+ *
+ * Version 3.2
+ * Add: headless offscreen mode with injectable input
+ * 10/17/2026
+ *
  * Version 3.1
  * Add: color and point constructors
  * 12/14/2022
@@ -50,7 +90,29 @@ const int BLUE_SHIFT   = 1;
 const int ALPHA_SHIFT  = 16777216;
 const int WHITE        = 255;
 const int MAX_THREAD   = 100;
+const int MAX_DIRTY_RECTS = 16;
+const Uint32 CLEAR_PIXEL  = 0xFFFFFFFF;    //clear() fill, no color packs to it
+
+//Opaque span of an image: length pixels from column x of image row y
+struct ImageRun{
+    int y, x, length;
+};
 
+//Backend
+enum PlotterMode{
+    PLOTTER_WINDOW,     //SDL window, renderer and audio
+    PLOTTER_HEADLESS,   //offscreen framebuffer only, no display or audio
+    PLOTTER_STREAMING   //window, drawing straight into a locked streaming
+                        //texture; falls back to PLOTTER_WINDOW if locking fails
+};
+
+
+//Fill kernel used by clear and the span fills
+enum FillKernelType{
+    FILL_SCALAR,
+    FILL_SSE2,
+    FILL_AVX2
+};
 
 //Point
 struct point{
@@ -106,11 +168,28 @@ private:
     SDL_Texture  *texture;
     SDL_Renderer *renderer;
     SDL_Window   *window;
-    Uint32       *pixels;
+    Uint32       *pixels;      //current draw target: buffer, or the locked texture
+    Uint32       *buffer;      //own framebuffer, kept for the static fallback
+    int          pitch;        //pixels from one row of pixels to the next
     const Uint8  *currentKeyStates;
     SDL_Event    event;
     int          row, col;
+    int          top, bottom;  //rows drawing may touch: all, or one band
     bool         quit;
+    PlotterMode  mode;
+
+    //Damage since the last update, merged into a few rectangles
+    SDL_Rect     dirty[MAX_DIRTY_RECTS];
+    int          dirtyCount;
+    bool         incremental;
+    size_t       bytesUploaded;
+
+    void addDirty(int x0, int y0, int x1, int y1);
+    void fillPacked(int x, int y, int width, int height, Uint32 packed);
+
+    //Streaming texture
+    bool lockStreaming();
+    void fallbackToStatic();
 
     //Keyboard Stuff
     queue<char> key_queue;
@@ -126,7 +205,17 @@ private:
     char getKeyPress(SDL_Event & event);
 
 public:
-    SDL_Plotter(int r=480, int c=640, bool WITH_SOUND = true);
+    SDL_Plotter(int r=480, int c=640, bool WITH_SOUND = true,
+                PlotterMode MODE = PLOTTER_WINDOW);
+
+    //Band view: a headless plotter drawing straight into rows
+    //[top, bottom) of parent's frame and clipped to them, so one thread
+    //per band can draw the same frame without locking. Coordinates stay
+    //those of the whole frame. Rebind every frame (a streaming parent
+    //moves its pixels), then mergeBand once the band's thread is done.
+    SDL_Plotter(SDL_Plotter& parent, int top, int bottom);
+    void bindBand(SDL_Plotter& parent, int top, int bottom);
+    void mergeBand(SDL_Plotter& band);
     ~SDL_Plotter();
     void update();
 
@@ -138,14 +227,48 @@ public:
     char getKey();
     point getMouseClick();
 
+    //Headless input injection (stands in for SDL_PollEvent)
+    void pushKey(char key);
+    void pushMouseClick(point p);
+    bool isHeadless();
+
     void plotPixel(int x, int y, int r, int g, int b);
     void plotPixel(point p, int r, int g, int b);
     void plotPixel(int x, int y, color=color{});
     void plotPixel(point p, color=color{});
 
+    //Span fills: clipped and color packed once per call
+    void hline(int x, int y, int length, color c);
+    void vline(int x, int y, int length, color c);
+    void fillRect(int x, int y, int width, int height, color c);
+    void fillRows(int y, int height, color c);
+    void blitRows(int y, int height, const Uint32* src);    //src rows are getCol() wide
+    //Bit i of rows[r] plots (x + i, y + r); width at most 32
+    void blitMask(int x, int y, int width, int height, const Uint32* rows, color c);
+    //Copy only the runs of a width x height image, runs in row order
+    void blitRuns(int x, int y, int width, int height, const Uint32* image,
+                  const ImageRun* runs, int count);
+
     void clear();
+    void clear(color c);    //whole buffer to one color, no white pass first
+
+    //Damage tracking: update() uploads only what was drawn since the
+    //last update. An incremental frame keeps the previous pixels, so
+    //clear() does nothing and the caller redraws only what changed.
+    //A freshly locked streaming texture holds no previous pixels, so
+    //streaming frames are never incremental.
+    void setIncremental(bool flag);
+    bool isIncremental();
+    void markDirty(int x, int y, int w, int h);    //for writes through getPixels
+    size_t getBytesUploaded();                      //by the last update()
+
+    //Fill kernel, best supported one picked at startup
+    static FillKernelType getFillKernel();
+    static bool setFillKernel(FillKernelType type);
     int getRow();
     int getCol();
+    int getTop();       //first row drawing may touch: 0, or a band's top
+    int getBottom();    //one past the last: getRow(), or a band's bottom
 
     void initSound(string sound);
     void playSound(string sound);
@@ -159,6 +282,9 @@ public:
     void getMouseLocation(int& x, int& y);
 
     Uint32 getColor(int x, int y);
+    const Uint32* getPixels();      //rows are getPitch() pixels apart
+    int getPitch();                 //getCol() except while streaming
+    PlotterMode getMode();
 
 };
 
@@ -7,6 +7,34 @@
 
 #include "Screen.h"
 
+// BASE SCREEN
+
+void Screen::save(StateWriter& w) const {
+    w.putInt(finalScore);
+    w.putInt(flashTimer);
+}
+
+void Screen::load(StateReader& r) {
+    finalScore = r.getInt();
+    flashTimer = r.getInt();
+    layerValid = false;
+}
+
+void Screen::draw(SDL_Plotter& g) {
+    // The last frame still holds the static layer unless its inputs changed
+    if(!layerValid) g.setIncremental(false);
+    if(!g.isIncremental()) {
+        drawLayer(g);
+        layerValid = true;
+    }
+    drawAnimated(g);
+}
+
+void Screen::drawFlashing(SDL_Plotter& g, int x, int y, color c, color bg, const std::string& text) const {
+    g.fillRect(x, y, FontRenderer::smallTextWidth(text), FONT_SMALL_HEIGHT, bg);
+    FontRenderer::drawSmall(g, x, y, c, text, flashTimer);
+}
+
 // START SCREEN
 
 StartScreen::StartScreen() {}
@@ -15,20 +43,18 @@ void StartScreen::update() {
     flashTimer++;
 }
 
-void StartScreen::draw(SDL_Plotter& g) {
+void StartScreen::drawLayer(SDL_Plotter& g) {
     // BACKGROUND
-    for(int x = 0; x < ROW; x++) {
-        for(int y = 0; y < COL; y++) {
-            g.plotPixel(x, y, BG_START);
-        }
-    }
+    g.clear(BG_START);
 
     // TITLE
     FontRenderer::drawLarge(g, 110, COL / 2 - 80, YELLOW, "PIXEL RACERS", 0);
+}
 
+void StartScreen::drawAnimated(SDL_Plotter& g) {
     // OPTIONS
-    FontRenderer::drawSmall(g, 100, COL / 2 - 15, WHITE2, "Press I for Instructions", flashTimer);
-    FontRenderer::drawSmall(g, 155, COL / 2 + 15, WHITE2, "Press S to START", flashTimer);
+    drawFlashing(g, 100, COL / 2 - 15, WHITE2, BG_START, "Press I for Instructions");
+    drawFlashing(g, 155, COL / 2 + 15, WHITE2, BG_START, "Press S to START");
 }
 
 bool StartScreen::handleInput(char key) {
@@ -46,13 +72,9 @@ void InstructionsScreen::update() {
     }
 }
 
-void InstructionsScreen::draw(SDL_Plotter& g) {
+void InstructionsScreen::drawLayer(SDL_Plotter& g) {
     // BACKGROUND
-    for(int x = 0; x < ROW; x++) {
-        for(int y = 0; y < COL; y++) {
-            g.plotPixel(x, y, BG_INSTRUCTIONS);
-        }
-    }
+    g.clear(BG_INSTRUCTIONS);
 
     // CONTROLS HEADER
     FontRenderer::drawLarge(g, 30, 40, CYAN, "CONTROLS", 0);
@@ -73,6 +95,16 @@ bool InstructionsScreen::handleInput(char key) {
     return (toupper(key) == 'I');
 }
 
+void InstructionsScreen::save(StateWriter& w) const {
+    Screen::save(w);
+    w.putInt(scrollOffset);
+}
+
+void InstructionsScreen::load(StateReader& r) {
+    Screen::load(r);
+    scrollOffset = r.getInt();
+}
+
 // PAUSE SCREEN
 
 PauseScreen::PauseScreen() {}
@@ -81,20 +113,18 @@ void PauseScreen::update() {
     flashTimer++;
 }
 
-void PauseScreen::draw(SDL_Plotter& g) {
+void PauseScreen::drawLayer(SDL_Plotter& g) {
     // BACKGROUND
-    for(int x = 0; x < ROW; x++) {
-        for(int y = 0; y < COL; y++) {
-            g.plotPixel(x, y, BG_PAUSED);
-        }
-    }
+    g.clear(BG_PAUSED);
 
     // PAUSE MESSAGE
     FontRenderer::drawLarge(g, 200, COL / 2 - 30, YELLOW, "PAUSED", 0);
+    FontRenderer::drawSmall(g, 140, COL / 2 + 50, CYAN, "Press B to go BACK", 0);
+}
 
+void PauseScreen::drawAnimated(SDL_Plotter& g) {
     // OPTIONS
-    FontRenderer::drawSmall(g, 150, COL / 2 + 20, YELLOW, "Press P to Resume", flashTimer);
-    FontRenderer::drawSmall(g, 140, COL / 2 + 50, CYAN, "Press B to go BACK", 0);
+    drawFlashing(g, 150, COL / 2 + 20, YELLOW, BG_PAUSED, "Press P to Resume");
 }
 
 bool PauseScreen::handleInput(char key) {
@@ -111,19 +141,16 @@ void GameOverScreen::setGameOver(int score, bool aiHit, bool obstacleHit) {
     finalScore = score;
     hitAI = aiHit;
     hitObstacle = obstacleHit;
+    layerValid = false;
 }
 
 void GameOverScreen::update() {
     flashTimer++;
 }
 
-void GameOverScreen::draw(SDL_Plotter& g) {
+void GameOverScreen::drawLayer(SDL_Plotter& g) {
     // BACKGROUND
-    for(int x = 0; x < ROW; x++) {
-        for(int y = 0; y < COL; y++) {
-            g.plotPixel(x, y, BG_GAME_OVER);
-        }
-    }
+    g.clear(BG_GAME_OVER);
 
     // GAME OVER TITLE
     FontRenderer::drawLarge(g, 150, COL / 2 - 70, RED, "GAME OVER", 0);
@@ -132,44 +159,55 @@ void GameOverScreen::draw(SDL_Plotter& g) {
     FontRenderer::drawSmall(g, 160, COL / 2 - 20, WHITE2, "Final Score: ", 0);
     std::string scoreStr = std::to_string(finalScore);
     FontRenderer::drawSmall(g, 360, COL / 2 - 20, WHITE2, scoreStr, 0);
+}
 
+void GameOverScreen::drawAnimated(SDL_Plotter& g) {
     // COLLISION INFORMATION
     int yPos = COL / 2 + 10;
     if(hitAI) {
-        FontRenderer::drawSmall(g, 190, yPos, AI_BLUE, "Hit AI Car!", flashTimer);
+        drawFlashing(g, 190, yPos, AI_BLUE, BG_GAME_OVER, "Hit AI Car!");
         yPos += GAME_OVER_Y_SPACING;
     }
     if(hitObstacle) {
-        FontRenderer::drawSmall(g, 180, yPos, ORANGE, "Hit Obstacle!", flashTimer);
+        drawFlashing(g, 180, yPos, ORANGE, BG_GAME_OVER, "Hit Obstacle!");
     }
 
     // OPTION
-    FontRenderer::drawSmall(g, 140, COL - 90, WHITE2, "Press C to Restart", flashTimer);
+    drawFlashing(g, 140, COL - 90, WHITE2, BG_GAME_OVER, "Press C to Restart");
 }
 
 bool GameOverScreen::handleInput(char key) {
     return (toupper(key) == 'C');
 }
 
+void GameOverScreen::save(StateWriter& w) const {
+    Screen::save(w);
+    w.putBool(hitAI);
+    w.putBool(hitObstacle);
+}
+
+void GameOverScreen::load(StateReader& r) {
+    Screen::load(r);
+    hitAI = r.getBool();
+    hitObstacle = r.getBool();
+}
+
 // WIN SCREEN
 
 WinScreen::WinScreen() {}
 
 void WinScreen::setWin(int score) {
     finalScore = score;
+    layerValid = false;
 }
 
 void WinScreen::update() {
     flashTimer++;
 }
 
-void WinScreen::draw(SDL_Plotter& g) {
+void WinScreen::drawLayer(SDL_Plotter& g) {
     // BACKGROUND
-    for(int x = 0; x < ROW; x++) {
-        for(int y = 0; y < COL; y++) {
-            g.plotPixel(x, y, BG_WIN);
-        }
-    }
+    g.clear(BG_WIN);
 
     // WIN MESSAGE
     FontRenderer::drawLarge(g, 150, COL / 2 - 70, GREEN, "YOU WIN!", 0);
@@ -178,9 +216,11 @@ void WinScreen::draw(SDL_Plotter& g) {
     FontRenderer::drawSmall(g, 160, COL / 2 - 20, WHITE2, "Final Score: ", 0);
     std::string scoreStr = std::to_string(finalScore);
     FontRenderer::drawSmall(g, 360, COL / 2 - 20, WHITE2, scoreStr, 0);
+}
 
+void WinScreen::drawAnimated(SDL_Plotter& g) {
     // OPTION
-    FontRenderer::drawSmall(g, 140, COL - 90, CYAN, "Press C to Restart", flashTimer);
+    drawFlashing(g, 140, COL - 90, CYAN, BG_WIN, "Press C to Restart");
 }
 
 bool WinScreen::handleInput(char key) {
@@ -10,12 +10,40 @@
 
 #include "Const.h"
 #include "Font.h"
+#include "State.h"
 
 // BASE SCREEN CLASS
 class Screen {
 protected:
     int finalScore; // Final player score
     int flashTimer; // Timer for flashing text effects
+    bool layerValid; // Static layer on screen still matches finalScore and flags
+
+    /*
+     * Description: Erase and redraw a line of flashing small text
+     * Return: void
+     * Pre-condition: bg is the color behind the text
+     * Post-condition: Line correct for this flashTimer on incremental
+     *                 frames, where the old pixels are still there
+     */
+    void drawFlashing(SDL_Plotter& g, int x, int y, color c, color bg, const std::string& text) const;
+
+    /*
+     * Description: Draw everything that does not animate: background,
+     *              titles and score
+     * Return: void
+     * Pre-condition: SDL_Plotter g is initialized
+     * Post-condition: Every pixel of the screen written
+     */
+    virtual void drawLayer(SDL_Plotter& g) = 0;
+
+    /*
+     * Description: Draw the flashing lines over the static layer
+     * Return: void
+     * Pre-condition: Static layer already on g
+     * Post-condition: Animated elements correct for this flashTimer
+     */
+    virtual void drawAnimated(SDL_Plotter&) {}
 
 public:
     /*
@@ -24,7 +52,7 @@ public:
      * Pre-condition: None
      * Post-condition: Screen created with finalScore = 0, flashTimer = 0
      */
-    Screen() : finalScore{0}, flashTimer{0} {}
+    Screen() : finalScore{0}, flashTimer{0}, layerValid{false} {}
 
     /*
      * Description: Update screen state
@@ -35,12 +63,14 @@ public:
     virtual void update() = 0;
 
     /*
-     * Description: Draw screen to display
+     * Description: Draw screen to display. An incremental frame keeps the
+     *              static layer of the last one and redraws only the
+     *              animated elements, unless the layer is out of date.
      * Return: void
      * Pre-condition: SDL_Plotter g is initialized
      * Post-condition: Screen rendered to plotter
      */
-    virtual void draw(SDL_Plotter& g) = 0;
+    void draw(SDL_Plotter& g);
 
     /*
      * Description: Handle keyboard input for screen
@@ -50,6 +80,23 @@ public:
      */
     virtual bool handleInput(char key) = 0;
 
+    /*
+     * Description: Append score and animation timers to a snapshot
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: State encoded into w
+     */
+    virtual void save(StateWriter& w) const;
+
+    /*
+     * Description: Restore score and animation timers from a snapshot
+     * Return: void
+     * Pre-condition: r positioned at data written by save()
+     * Post-condition: State replaced, r advanced, static layer redrawn
+     *                 on the next frame
+     */
+    virtual void load(StateReader& r);
+
     /*
      * Description: Virtual destructor
      * Return: None (destructor)
@@ -61,6 +108,23 @@ public:
 
 // START SCREEN
 class StartScreen : public Screen {
+protected:
+    /*
+     * Description: Draw start screen background and title
+     * Return: void
+     * Pre-condition: SDL_Plotter g is initialized
+     * Post-condition: Every pixel of the screen written
+     */
+    void drawLayer(SDL_Plotter& g) override;
+
+    /*
+     * Description: Draw flashing start options
+     * Return: void
+     * Pre-condition: Static layer already on g
+     * Post-condition: Flashing lines correct for this flashTimer
+     */
+    void drawAnimated(SDL_Plotter& g) override;
+
 public:
     /*
      * Description: Initialize start screen
@@ -78,14 +142,6 @@ public:
      */
     void update() override;
 
-    /*
-     * Description: Draw start screen with title and instructions
-     * Return: void
-     * Pre-condition: SDL_Plotter g is initialized
-     * Post-condition: Start screen rendered to plotter
-     */
-    void draw(SDL_Plotter& g) override;
-
     /*
      * Description: Handle start screen input (S to start game)
      * Return: bool - true if S pressed, false otherwise
@@ -100,6 +156,15 @@ class InstructionsScreen : public Screen {
 private:
     int scrollOffset; // Offset for scrolling animation
 
+protected:
+    /*
+     * Description: Draw instructions screen with controls guide
+     * Return: void
+     * Pre-condition: SDL_Plotter g is initialized
+     * Post-condition: Every pixel of the screen written
+     */
+    void drawLayer(SDL_Plotter& g) override;
+
 public:
     /*
      * Description: Initialize instructions screen
@@ -117,14 +182,6 @@ public:
      */
     void update() override;
 
-    /*
-     * Description: Draw instructions screen with controls guide
-     * Return: void
-     * Pre-condition: SDL_Plotter g is initialized
-     * Post-condition: Instructions screen rendered to plotter
-     */
-    void draw(SDL_Plotter& g) override;
-
     /*
      * Description: Handle instructions screen input (I to go back)
      * Return: bool - true if I pressed, false otherwise
@@ -132,10 +189,43 @@ public:
      * Post-condition: Input processed, no state change to screen
      */
     bool handleInput(char key) override;
+
+    /*
+     * Description: Append timers and scroll offset to a snapshot
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: State encoded into w
+     */
+    void save(StateWriter& w) const override;
+
+    /*
+     * Description: Restore timers and scroll offset from a snapshot
+     * Return: void
+     * Pre-condition: r positioned at data written by save()
+     * Post-condition: State replaced, r advanced
+     */
+    void load(StateReader& r) override;
 };
 
 // PAUSE SCREEN
 class PauseScreen : public Screen {
+protected:
+    /*
+     * Description: Draw pause screen background, message and back option
+     * Return: void
+     * Pre-condition: SDL_Plotter g is initialized
+     * Post-condition: Every pixel of the screen written
+     */
+    void drawLayer(SDL_Plotter& g) override;
+
+    /*
+     * Description: Draw flashing resume option
+     * Return: void
+     * Pre-condition: Static layer already on g
+     * Post-condition: Flashing lines correct for this flashTimer
+     */
+    void drawAnimated(SDL_Plotter& g) override;
+
 public:
     /*
      * Description: Initialize pause screen
@@ -153,14 +243,6 @@ public:
      */
     void update() override;
 
-    /*
-     * Description: Draw pause screen with message and options
-     * Return: void
-     * Pre-condition: SDL_Plotter g is initialized
-     * Post-condition: Pause screen rendered to plotter
-     */
-    void draw(SDL_Plotter& g) override;
-
     /*
      * Description: Handle pause screen input (P to resume game)
      * Return: bool - true if P pressed, false otherwise
@@ -176,6 +258,23 @@ private:
     bool hitAI;			// Whether collision was with AI
     bool hitObstacle;	// Whether collision was with obstacle
 
+protected:
+    /*
+     * Description: Draw game over screen background, title and final score
+     * Return: void
+     * Pre-condition: SDL_Plotter g is initialized
+     * Post-condition: Every pixel of the screen written
+     */
+    void drawLayer(SDL_Plotter& g) override;
+
+    /*
+     * Description: Draw flashing collision info and restart option
+     * Return: void
+     * Pre-condition: Static layer already on g
+     * Post-condition: Flashing lines correct for this flashTimer
+     */
+    void drawAnimated(SDL_Plotter& g) override;
+
 public:
     /*
      * Description: Initialize game over screen
@@ -189,25 +288,34 @@ public:
      * Description: Set game over condition and final score
      * Return: void
      * Pre-condition: score >= 0, aiHit and obstacleHit are valid
-     * Post-condition: Game over state set with provided values
+     * Post-condition: Game over state set with provided values, static
+     *                 layer redrawn on the next frame
      */
     void setGameOver(int score, bool aiHit, bool obstacleHit);
 
     /*
-     * Description: Update game over screen animations
-     * Return: void
+     * Description: Check if the race ended on an AI car
+     * Return: bool - hitAI flag
      * Pre-condition: None
-     * Post-condition: flashTimer incremented
+     * Post-condition: No state change
      */
-    void update() override;
+    bool getHitAI() const { return hitAI; }
+
+    /*
+     * Description: Check if the race ended on an obstacle
+     * Return: bool - hitObstacle flag
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    bool getHitObstacle() const { return hitObstacle; }
 
     /*
-     * Description: Draw game over screen with score and collision info
+     * Description: Update game over screen animations
      * Return: void
-     * Pre-condition: SDL_Plotter g is initialized
-     * Post-condition: Game over screen rendered to plotter
+     * Pre-condition: None
+     * Post-condition: flashTimer incremented
      */
-    void draw(SDL_Plotter& g) override;
+    void update() override;
 
     /*
      * Description: Handle game over screen input (C to restart)
@@ -216,10 +324,43 @@ public:
      * Post-condition: Input processed, no state change to screen
      */
     bool handleInput(char key) override;
+
+    /*
+     * Description: Append score, timers and collision flags to a snapshot
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: State encoded into w
+     */
+    void save(StateWriter& w) const override;
+
+    /*
+     * Description: Restore score, timers and collision flags from a snapshot
+     * Return: void
+     * Pre-condition: r positioned at data written by save()
+     * Post-condition: State replaced, r advanced
+     */
+    void load(StateReader& r) override;
 };
 
 // WIN SCREEN
 class WinScreen : public Screen {
+protected:
+    /*
+     * Description: Draw win screen background, victory message and score
+     * Return: void
+     * Pre-condition: SDL_Plotter g is initialized
+     * Post-condition: Every pixel of the screen written
+     */
+    void drawLayer(SDL_Plotter& g) override;
+
+    /*
+     * Description: Draw flashing restart option
+     * Return: void
+     * Pre-condition: Static layer already on g
+     * Post-condition: Flashing lines correct for this flashTimer
+     */
+    void drawAnimated(SDL_Plotter& g) override;
+
 public:
     /*
      * Description: Initialize win screen
@@ -233,7 +374,8 @@ public:
      * Description: Set win condition and final score
      * Return: void
      * Pre-condition: score >= 0
-     * Post-condition: Win state set with score, collision flags reset
+     * Post-condition: Win state set with score, static layer redrawn
+     *                 on the next frame
      */
     void setWin(int score);
 
@@ -245,14 +387,6 @@ public:
      */
     void update() override;
 
-    /*
-     * Description: Draw win screen with victory message and score
-     * Return: void
-     * Pre-condition: SDL_Plotter g is initialized
-     * Post-condition: Win screen rendered to plotter
-     */
-    void draw(SDL_Plotter& g) override;
-
     /*
      * Description: Handle win screen input (C to restart)
      * Return: bool - true if C pressed, false otherwise
@@ -0,0 +1,54 @@
+//================================================================
+// SpatialGrid.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Spatial Grid Implementation
+// Description: Cell lists kept up to date as entities move
+//================================================================
+
+#include "SpatialGrid.h"
+
+// CONSTRUCTOR
+SpatialGrid::SpatialGrid()
+    : cols{(ROW + GRID_CELL_SIZE - 1) / GRID_CELL_SIZE},
+      rows{(GRID_BOTTOM - GRID_TOP + GRID_CELL_SIZE - 1) / GRID_CELL_SIZE},
+      reach{0},
+      head(cols * rows, -1) {}
+
+void SpatialGrid::clear() {
+    fill(head.begin(), head.end(), -1);
+    fill(cellOf.begin(), cellOf.end(), -1);
+    reach = 0;
+}
+
+// PLACEMENT
+void SpatialGrid::unlink(int id) {
+    if(prev[id] >= 0) next[prev[id]] = next[id];
+    else head[cellOf[id]] = next[id];
+    if(next[id] >= 0) prev[next[id]] = prev[id];
+}
+
+void SpatialGrid::place(int id, int x, int y, int halfSize) {
+    if(id >= (int)cellOf.size()) {
+        next.resize(id + 1, -1);
+        prev.resize(id + 1, -1);
+        cellOf.resize(id + 1, -1);
+    }
+    reach = max(reach, halfSize);
+
+    // Most ticks an entity stays in its cell: nothing to relink
+    int cell = rowAt(y) * cols + colAt(x);
+    if(cellOf[id] == cell) return;
+    if(cellOf[id] >= 0) unlink(id);
+
+    cellOf[id] = cell;
+    prev[id] = -1;
+    next[id] = head[cell];
+    if(next[id] >= 0) prev[next[id]] = id;
+    head[cell] = id;
+}
+
+void SpatialGrid::remove(int id) {
+    if(id >= (int)cellOf.size() || cellOf[id] < 0) return;
+    unlink(id);
+    cellOf[id] = -1;
+}
@@ -0,0 +1,113 @@
+//================================================================
+// SpatialGrid.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Spatial Grid
+// Description: Uniform grid bucketing entities by center so that
+//              collision checks only visit nearby ones
+//================================================================
+
+#ifndef SpatialGrid_h
+#define SpatialGrid_h
+
+#include "Const.h"
+#include <vector>
+
+class SpatialGrid {
+private:
+    int cols;                   // Cells across ROW
+    int rows;                   // Cells from GRID_TOP to GRID_BOTTOM
+    int reach;                  // Largest half size placed since clear()
+
+    // Each cell is a doubly linked list of entity ids
+    vector<int> head;           // First id per cell, -1 if empty
+    vector<int> next;           // Per id
+    vector<int> prev;           // Per id
+    vector<int> cellOf;         // Per id, -1 if not placed
+
+    /*
+     * Description: Cell column of an x coordinate, clamped to the grid
+     * Return: int - column index
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    int colAt(int x) const {
+        return x < 0 ? 0 : min(x / GRID_CELL_SIZE, cols - 1);
+    }
+
+    /*
+     * Description: Cell row of a y coordinate, clamped to the grid
+     * Return: int - row index
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    int rowAt(int y) const {
+        return y < GRID_TOP ? 0 : min((y - GRID_TOP) / GRID_CELL_SIZE, rows - 1);
+    }
+
+    /*
+     * Description: Take an entity out of its cell's list
+     * Return: void
+     * Pre-condition: id is placed
+     * Post-condition: id unlinked, cellOf[id] unchanged
+     */
+    void unlink(int id);
+
+public:
+    /*
+     * Description: Initialize an empty grid over the play area
+     * Return: None (constructor)
+     * Pre-condition: None
+     * Post-condition: No entities placed
+     */
+    SpatialGrid();
+
+    /*
+     * Description: Remove every entity
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Grid empty, storage kept
+     */
+    void clear();
+
+    /*
+     * Description: Put an entity at its current center, moving it only if
+     *              it changed cells since the last call
+     * Return: void
+     * Pre-condition: id >= 0, halfSize >= 0
+     * Post-condition: id listed in the cell holding x, y
+     */
+    void place(int id, int x, int y, int halfSize);
+
+    /*
+     * Description: Take an entity off the grid
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: id no longer visited by queries
+     */
+    void remove(int id);
+
+    /*
+     * Description: Visit every entity whose box may overlap a box,
+     *              stopping early once visit returns true
+     * Return: bool - true if a visit returned true
+     * Pre-condition: visit is callable as bool visit(int id)
+     * Post-condition: Each placed id with a box overlapping left..right,
+     *                 top..bottom visited once; some that do not overlap
+     *                 may be visited too, so callers still test exactly
+     */
+    template <typename Visit>
+    bool query(int left, int top, int right, int bottom, Visit visit) const {
+        int c0 = colAt(left - reach), c1 = colAt(right + reach);
+        int r0 = rowAt(top - reach), r1 = rowAt(bottom + reach);
+        for(int r = r0; r <= r1; r++) {
+            for(int c = c0; c <= c1; c++) {
+                for(int id = head[r * cols + c]; id >= 0; id = next[id]) {
+                    if(visit(id)) return true;
+                }
+            }
+        }
+        return false;
+    }
+};
+
+#endif /* SpatialGrid_h */
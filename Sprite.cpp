@@ -0,0 +1,39 @@
+//================================================================
+// Sprite.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Sprite Implementation
+// Description: Capture of a drawn canvas into image runs
+//================================================================
+
+#include "Sprite.h"
+
+Sprite::Sprite() : width{0}, height{0} {}
+
+Sprite::Sprite(SDL_Plotter& canvas)
+    : width{canvas.getCol()},
+      height{canvas.getRow()},
+      image((size_t)width * height)
+{
+    // Whatever still holds the clear() fill is transparent
+    const Uint32* pixels = canvas.getPixels();
+    const int pitch = canvas.getPitch();
+
+    for(int y = 0; y < height; y++) {
+        const Uint32* line = pixels + y * pitch;
+        for(int x = 0; x < width; x++) image[y * width + x] = line[x];
+
+        int x = 0;
+        while(x < width) {
+            while(x < width && line[x] == CLEAR_PIXEL) x++;
+            int start = x;
+            while(x < width && line[x] != CLEAR_PIXEL) x++;
+            if(x > start) runs.push_back(ImageRun{y, start, x - start});
+        }
+    }
+}
+
+int Sprite::getOpaqueCount() const {
+    int count = 0;
+    for(const ImageRun& r : runs) count += r.length;
+    return count;
+}
@@ -0,0 +1,107 @@
+//================================================================
+// Sprite.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Sprites
+// Description: Pre-rasterized color-keyed images drawn as opaque
+//              runs, and a shared cache of them
+//================================================================
+
+#ifndef Sprite_h
+#define Sprite_h
+
+#include "SDL_Plotter.h"
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <vector>
+
+class Sprite {
+private:
+    int width;                  // Image size in pixels
+    int height;
+    vector<Uint32>   image;     // Packed pixels, row-major
+    vector<ImageRun> runs;      // Opaque spans in row order
+
+public:
+    /*
+     * Description: Initialize an empty sprite
+     * Return: None (constructor)
+     * Pre-condition: None
+     * Post-condition: Sprite draws nothing
+     */
+    Sprite();
+
+    /*
+     * Description: Capture everything drawn on canvas since its clear()
+     * Return: None (constructor)
+     * Pre-condition: canvas cleared with clear(), then drawn with
+     *                color values only (never the clear fill)
+     * Post-condition: Sprite holds the drawn pixels; the rest is
+     *                 transparent
+     */
+    explicit Sprite(SDL_Plotter& canvas);
+
+    /*
+     * Description: Draw the opaque pixels with the top-left corner at x, y
+     * Return: void
+     * Pre-condition: SDL_Plotter g is initialized
+     * Post-condition: Sprite drawn, clipped to the screen
+     */
+    void draw(SDL_Plotter& g, int x, int y) const {
+        g.blitRuns(x, y, width, height, image.data(), runs.data(), (int)runs.size());
+    }
+
+    /*
+     * Description: Get sprite width
+     * Return: int - width in pixels
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    int getWidth() const { return width; }
+
+    /*
+     * Description: Get sprite height
+     * Return: int - height in pixels
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    int getHeight() const { return height; }
+
+    /*
+     * Description: Count opaque pixels
+     * Return: int - pixels draw() writes when unclipped
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    int getOpaqueCount() const;
+};
+
+// Sprites rasterized on first use, safe to share between threads
+class SpriteCache {
+private:
+    std::mutex mut;
+    std::map<uint64_t, Sprite> sprites;  // Node-based: references stay valid
+
+public:
+    /*
+     * Description: Get the sprite for key, rasterizing it with paint on a
+     *              cleared width x height canvas the first time
+     * Return: const Sprite& - cached sprite, valid for the cache's lifetime
+     * Pre-condition: Same key always means the same paint and size
+     * Post-condition: Sprite for key cached
+     */
+    template <class Paint>
+    const Sprite& get(uint64_t key, int width, int height, Paint paint) {
+        std::lock_guard<std::mutex> lock(mut);
+        std::map<uint64_t, Sprite>::iterator it = sprites.find(key);
+        if(it == sprites.end()) {
+            SDL_Plotter canvas(height, width, false, PLOTTER_HEADLESS);
+            canvas.clear();
+            paint(canvas);
+            it = sprites.emplace(key, Sprite(canvas)).first;
+        }
+        return it->second;
+    }
+};
+
+#endif /* Sprite_h */
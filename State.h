@@ -0,0 +1,220 @@
+//================================================================
+// State.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: State Serialization
+// Description: Compact byte encoding for game state snapshots
+//================================================================
+
+#ifndef State_h
+#define State_h
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+// WRITER - APPENDS TO A CALLER-OWNED BUFFER
+class StateWriter {
+private:
+    std::vector<uint8_t>& _out;     // Destination buffer
+
+public:
+    /*
+     * Description: Initialize writer appending to out
+     * Return: None (constructor)
+     * Pre-condition: out outlives the writer
+     * Post-condition: Writer ready, out unchanged
+     */
+    explicit StateWriter(std::vector<uint8_t>& out) : _out(out) {}
+
+    /*
+     * Description: Write unsigned value as LEB128 varint (7 bits per byte)
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: 1-5 bytes appended
+     */
+    void putVarint(uint32_t value) {
+        while(value >= 0x80) {
+            _out.push_back(static_cast<uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        _out.push_back(static_cast<uint8_t>(value));
+    }
+
+    /*
+     * Description: Write signed value as zigzag varint
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Small magnitudes take one byte
+     */
+    void putInt(int value) {
+        uint32_t v = static_cast<uint32_t>(value);
+        putVarint((v << 1) ^ (value < 0 ? 0xFFFFFFFFu : 0u));
+    }
+
+    /*
+     * Description: Write boolean as one byte
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: 1 byte appended
+     */
+    void putBool(bool value) { _out.push_back(value ? 1 : 0); }
+
+    /*
+     * Description: Write raw byte
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: 1 byte appended
+     */
+    void putByte(uint8_t value) { _out.push_back(value); }
+
+    /*
+     * Description: Write fixed-width 32-bit value, little endian
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: 4 bytes appended
+     */
+    void putU32(uint32_t value) {
+        for(int i = 0; i < 4; i++) _out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+
+    /*
+     * Description: Write fixed-width 64-bit value, little endian
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: 8 bytes appended
+     */
+    void putU64(uint64_t value) {
+        for(int i = 0; i < 8; i++) _out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+};
+
+// READER - DECODES FROM A BYTE RANGE, FAILS SOFT ON TRUNCATION
+class StateReader {
+private:
+    const uint8_t* _data;   // Start of encoded bytes
+    size_t         _size;   // Number of bytes available
+    size_t         _pos;    // Read cursor
+    bool           _ok;     // False once a read ran past the end
+
+    bool take(uint8_t& byte) {
+        if(_pos >= _size) { _ok = false; byte = 0; return false; }
+        byte = _data[_pos++];
+        return true;
+    }
+
+public:
+    /*
+     * Description: Initialize reader over size bytes at data
+     * Return: None (constructor)
+     * Pre-condition: data valid for the reader's lifetime
+     * Post-condition: Cursor at start
+     */
+    StateReader(const uint8_t* data, size_t size)
+        : _data{data}, _size{size}, _pos{0}, _ok{true} {}
+
+    /*
+     * Description: Read LEB128 varint
+     * Return: uint32_t - decoded value, 0 on failure
+     * Pre-condition: None
+     * Post-condition: Cursor advanced, good() false if truncated
+     */
+    uint32_t getVarint() {
+        uint32_t value = 0;
+        for(int shift = 0; shift < 35; shift += 7) {
+            uint8_t byte;
+            if(!take(byte)) return 0;
+            value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+            if(!(byte & 0x80)) return value;
+        }
+        _ok = false;
+        return 0;
+    }
+
+    /*
+     * Description: Read zigzag varint
+     * Return: int - decoded value
+     * Pre-condition: None
+     * Post-condition: Cursor advanced
+     */
+    int getInt() {
+        uint32_t v = getVarint();
+        return static_cast<int>((v >> 1) ^ (0u - (v & 1)));
+    }
+
+    /*
+     * Description: Read boolean byte
+     * Return: bool - decoded value
+     * Pre-condition: None
+     * Post-condition: Cursor advanced
+     */
+    bool getBool() { uint8_t b; take(b); return b != 0; }
+
+    /*
+     * Description: Read raw byte
+     * Return: uint8_t - decoded value
+     * Pre-condition: None
+     * Post-condition: Cursor advanced
+     */
+    uint8_t getByte() { uint8_t b; take(b); return b; }
+
+    /*
+     * Description: Read fixed-width 32-bit value
+     * Return: uint32_t - decoded value
+     * Pre-condition: None
+     * Post-condition: Cursor advanced 4 bytes
+     */
+    uint32_t getU32() {
+        uint32_t value = 0;
+        for(int i = 0; i < 4; i++) value |= static_cast<uint32_t>(getByte()) << (8 * i);
+        return value;
+    }
+
+    /*
+     * Description: Read fixed-width 64-bit value
+     * Return: uint64_t - decoded value
+     * Pre-condition: None
+     * Post-condition: Cursor advanced 8 bytes
+     */
+    uint64_t getU64() {
+        uint64_t value = 0;
+        for(int i = 0; i < 8; i++) value |= static_cast<uint64_t>(getByte()) << (8 * i);
+        return value;
+    }
+
+    /*
+     * Description: Skip bytes without decoding
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Cursor advanced, good() false if past end
+     */
+    void skip(size_t count) {
+        if(count > _size - _pos) { _pos = _size; _ok = false; return; }
+        _pos += count;
+    }
+
+    /*
+     * Description: Get read cursor
+     * Return: size_t - bytes consumed so far
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    size_t position() const { return _pos; }
+
+    /*
+     * Description: Check whether any bytes remain
+     * Return: bool - true if cursor is at the end
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    bool atEnd() const { return _pos >= _size; }
+
+    /*
+     * Description: Check that no read has run past the end
+     * Return: bool - true if every read succeeded
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    bool good() const { return _ok; }
+};
+
+#endif /* State_h */
@@ -0,0 +1,392 @@
+//================================================================
+// TrafficStore.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Traffic Component Store Implementation
+// Description: AI car and cone behaviour as passes over component
+//              arrays
+//================================================================
+
+#include "TrafficStore.h"
+#include "Car.h"
+#include "Obstacle.h"
+#include "LaneRule.h"
+#include "Utils.h"
+#include <algorithm>
+#include <cstdlib>
+
+// STORAGE
+void TrafficStore::reserve(int cars, int cones) {
+    carX.reserve(cars);
+    carY.reserve(cars);
+    carPrvX.reserve(cars);
+    carPrvY.reserve(cars);
+    carSpeed.reserve(cars);
+    carSize.reserve(cars);
+    carLane.reserve(cars);
+    carTimer.reserve(cars);
+    carDelay.reserve(cars);
+    carChanging.reserve(cars);
+    carColor.reserve(cars);
+
+    coneX.reserve(cones);
+    coneY.reserve(cones);
+    conePrvX.reserve(cones);
+    conePrvY.reserve(cones);
+    coneSize.reserve(cones);
+    coneLeft.reserve(cones);
+    coneTop.reserve(cones);
+    coneRight.reserve(cones);
+    coneBottom.reserve(cones);
+}
+
+void TrafficStore::clear() {
+    carX.clear();
+    carY.clear();
+    carPrvX.clear();
+    carPrvY.clear();
+    carSpeed.clear();
+    carSize.clear();
+    carLane.clear();
+    carTimer.clear();
+    carDelay.clear();
+    carChanging.clear();
+    carColor.clear();
+
+    coneX.clear();
+    coneY.clear();
+    conePrvX.clear();
+    conePrvY.clear();
+    coneSize.clear();
+    coneLeft.clear();
+    coneTop.clear();
+    coneRight.clear();
+    coneBottom.clear();
+
+    carGrid.clear();
+    coneGrid.clear();
+}
+
+int TrafficStore::addCar(int x, int y, color look, int speed, Random& rng) {
+    // AI cars start in a random lane, whatever x says; the previous
+    // position keeps it
+    int lane = rng.nextInt(3);
+    carX.push_back(LANE_X[lane]);
+    carY.push_back(y);
+    carPrvX.push_back(x);
+    carPrvY.push_back(y);
+    carSpeed.push_back(speed);
+    carSize.push_back(SIZE);
+    carLane.push_back(lane);
+    carTimer.push_back(0);
+    carDelay.push_back(AI_LANE_CHANGE_DELAY);
+    carChanging.push_back(0);
+    carColor.push_back(look);
+    return getCarCount() - 1;
+}
+
+int TrafficStore::addCone(int x, int y, int size) {
+    coneX.push_back(x);
+    coneY.push_back(y);
+    conePrvX.push_back(x);
+    conePrvY.push_back(y);
+    coneSize.push_back(size);
+    coneLeft.push_back(0);
+    coneTop.push_back(0);
+    coneRight.push_back(0);
+    coneBottom.push_back(0);
+    packCone(getConeCount() - 1);
+    return getConeCount() - 1;
+}
+
+void TrafficStore::packCone(int i) {
+    int half = coneSize[i] / 2;
+    coneLeft[i] = coneX[i] - half;
+    coneRight[i] = coneX[i] + half;
+    coneTop[i] = coneY[i] - half;
+    coneBottom[i] = coneY[i] + half;
+}
+
+void TrafficStore::removeCar(int i) {
+    int last = getCarCount() - 1;
+    carX[i] = carX[last];
+    carY[i] = carY[last];
+    carPrvX[i] = carPrvX[last];
+    carPrvY[i] = carPrvY[last];
+    carSpeed[i] = carSpeed[last];
+    carSize[i] = carSize[last];
+    carLane[i] = carLane[last];
+    carTimer[i] = carTimer[last];
+    carDelay[i] = carDelay[last];
+    carChanging[i] = carChanging[last];
+    carColor[i] = carColor[last];
+
+    carX.pop_back();
+    carY.pop_back();
+    carPrvX.pop_back();
+    carPrvY.pop_back();
+    carSpeed.pop_back();
+    carSize.pop_back();
+    carLane.pop_back();
+    carTimer.pop_back();
+    carDelay.pop_back();
+    carChanging.pop_back();
+    carColor.pop_back();
+
+    // Index i is refiled with its new car by the next updateGrids
+    carGrid.remove(last);
+}
+
+void TrafficStore::removeCone(int i) {
+    int last = getConeCount() - 1;
+    coneX[i] = coneX[last];
+    coneY[i] = coneY[last];
+    conePrvX[i] = conePrvX[last];
+    conePrvY[i] = conePrvY[last];
+    coneSize[i] = coneSize[last];
+    coneLeft[i] = coneLeft[last];
+    coneTop[i] = coneTop[last];
+    coneRight[i] = coneRight[last];
+    coneBottom[i] = coneBottom[last];
+
+    coneX.pop_back();
+    coneY.pop_back();
+    conePrvX.pop_back();
+    conePrvY.pop_back();
+    coneSize.pop_back();
+    coneLeft.pop_back();
+    coneTop.pop_back();
+    coneRight.pop_back();
+    coneBottom.pop_back();
+
+    coneGrid.remove(last);
+}
+
+// SPAWNING
+void TrafficStore::spawn(int cars, int cones, Random& rng) {
+    while(getCarCount() < cars) {
+        int n = getCarCount();
+        respawnCar(addCar(CENTER_LANE_X, 0, TRAFFIC_COLORS[n % TRAFFIC_AI_CARS],
+                          TRAFFIC_SPEEDS[n % TRAFFIC_AI_CARS], rng), rng);
+    }
+    while(getConeCount() < cones) {
+        respawnCone(addCone(CENTER_LANE_X, 0, OBSTACLE_SIZE), rng);
+    }
+}
+
+void TrafficStore::respawnCar(int i, Random& rng) {
+    carLane[i] = rng.nextInt(3);
+    carX[i] = LANE_X[carLane[i]];
+    carY[i] = -carSize[i] - rng.nextInt(AI_SPAWN_Y_RANDOM_RANGE);
+    carPrvX[i] = carX[i];
+    carPrvY[i] = carY[i];
+    carTimer[i] = 0;
+}
+
+void TrafficStore::respawnCone(int i, Random& rng) {
+    coneX[i] = ROAD_START + OBSTACLE_SPAWN_MIN_X_OFFSET +
+               rng.nextInt(ROAD_WIDTH - OBSTACLE_SPAWN_MAX_X_OFFSET);
+    coneY[i] = -coneSize[i] - rng.nextInt(OBSTACLE_SPAWN_Y_RANDOM_RANGE);
+    conePrvX[i] = coneX[i];
+    conePrvY[i] = coneY[i];
+    packCone(i);
+}
+
+// MOVEMENT KERNELS: the arrays never overlap, and saying so with
+// __restrict lets VECTORIZE turn these loops into SIMD code
+
+/*
+ * Description: Remember each car's position, move it down by its speed
+ *              and advance its lane timer
+ * Return: void
+ * Pre-condition: Every array holds n entries
+ * Post-condition: Cars moved
+ */
+VECTORIZE
+static void moveCars(int n, const int* __restrict x, int* __restrict y,
+                     int* __restrict px, int* __restrict py,
+                     const int* __restrict speed, int* __restrict timer) {
+    for(int i = 0; i < n; i++) {
+        px[i] = x[i];
+        py[i] = y[i];
+        y[i] += speed[i];
+        timer[i]++;
+    }
+}
+
+/*
+ * Description: Remember each cone's position, then move it and its packed
+ *              box down by speed
+ * Return: void
+ * Pre-condition: Every array holds n entries
+ * Post-condition: Cones moved
+ */
+VECTORIZE
+static void moveCones(int n, const int* __restrict x, int* __restrict y,
+                      int* __restrict px, int* __restrict py,
+                      int* __restrict top, int* __restrict bottom, int speed) {
+    for(int i = 0; i < n; i++) {
+        px[i] = x[i];
+        py[i] = y[i];
+        y[i] += speed;
+        top[i] += speed;
+        bottom[i] += speed;
+    }
+}
+
+// AI CARS
+void TrafficStore::decideLane(int i, const LaneIndex& lanes, Random& rng) {
+    int y = carY[i];
+    carLane[i] = LaneRule::decide(carLane[i], rng, [&](int lane) {
+        return lanes.blockedAhead(static_cast<AILane>(lane), y, AI_LANE_LOOKAHEAD);
+    });
+}
+
+void TrafficStore::steerCar(int i, const LaneIndex& lanes, Random& rng) {
+    if(!carChanging[i] && carTimer[i] >= carDelay[i]) {
+        carTimer[i] = 0;
+        decideLane(i, lanes, rng);
+    }
+
+    int laneX = LANE_X[carLane[i]];
+    bool below = carX[i] < laneX - LANE_CHANGE_THRESHOLD;
+    bool above = carX[i] > laneX + LANE_CHANGE_THRESHOLD;
+    carX[i] = below ? carX[i] + LANE_CHANGE_STEP : above ? carX[i] - LANE_CHANGE_STEP : laneX;
+    carChanging[i] = below || above;
+}
+
+int TrafficStore::updateCars(const LaneIndex& lanes, Random& rng, int target) {
+    // MOVEMENT draws no random numbers, so it runs as one pass
+    moveCars(getCarCount(), carX.data(), carY.data(), carPrvX.data(), carPrvY.data(),
+             carSpeed.data(), carTimer.data());
+
+    // DECISIONS, STEERING AND RESPAWNS draw from the RNG in car order, so
+    // they share one pass. A dropped car's place goes to the last car,
+    // which has already moved.
+    int passed = 0;
+    for(int i = 0; i < getCarCount(); ) {
+        steerCar(i, lanes, rng);
+        if(isCarOffScreen(i)) {
+            passed++;
+            if(getCarCount() > target) {
+                removeCar(i);
+                continue;
+            }
+            respawnCar(i, rng);
+        }
+        i++;
+    }
+    return passed;
+}
+
+void TrafficStore::updateCar(int i, const LaneIndex& lanes, Random& rng) {
+    moveCars(1, &carX[i], &carY[i], &carPrvX[i], &carPrvY[i], &carSpeed[i], &carTimer[i]);
+    steerCar(i, lanes, rng);
+}
+
+// OBSTACLES
+int TrafficStore::updateCones(int speed, Random& rng, int target) {
+    moveCones(getConeCount(), coneX.data(), coneY.data(), conePrvX.data(), conePrvY.data(),
+              coneTop.data(), coneBottom.data(), speed);
+
+    // OFF SCREEN: respawns draw in cone order
+    int avoided = 0;
+    for(int i = 0; i < getConeCount(); ) {
+        if(isConeOffScreen(i)) {
+            avoided++;
+            if(getConeCount() > target) {
+                removeCone(i);
+                continue;
+            }
+            respawnCone(i, rng);
+        }
+        i++;
+    }
+    return avoided;
+}
+
+void TrafficStore::updateCone(int i, int speed) {
+    moveCones(1, &coneX[i], &coneY[i], &conePrvX[i], &conePrvY[i],
+              &coneTop[i], &coneBottom[i], speed);
+}
+
+// BROADPHASE
+void TrafficStore::updateGrids() {
+    for(int i = 0; i < getCarCount(); i++) {
+        int move = std::max(std::abs(carX[i] - carPrvX[i]), std::abs(carY[i] - carPrvY[i]));
+        carGrid.place(i, carX[i], carY[i], carSize[i] / 2 + move);
+    }
+    for(int i = 0; i < getConeCount(); i++) {
+        int move = std::max(std::abs(coneX[i] - conePrvX[i]), std::abs(coneY[i] - conePrvY[i]));
+        coneGrid.place(i, coneX[i], coneY[i], coneSize[i] / 2 + move);
+    }
+}
+
+// DRAW
+void TrafficStore::draw(DrawList& list, double alpha) const {
+    for(int i = 0; i < getConeCount(); i++) drawCone(i, list, alpha);
+    for(int i = 0; i < getCarCount(); i++) drawCar(i, list, alpha);
+}
+
+void TrafficStore::drawCar(int i, DrawList& list, double alpha) const {
+    point loc = blend(getCarPrvLoc(i), getCarLoc(i), alpha);
+    Car::drawAt(list, LAYER_CARS, loc, carColor[i], carSize[i]);
+}
+
+void TrafficStore::drawCone(int i, DrawList& list, double alpha) const {
+    point loc = blend(getConePrvLoc(i), getConeLoc(i), alpha);
+    Obstacle::drawAt(list, loc, coneSize[i]);
+}
+
+// SNAPSHOTS
+void TrafficStore::save(StateWriter& w) const {
+    w.putVarint(static_cast<uint32_t>(getCarCount()));
+    for(int i = 0; i < getCarCount(); i++) {
+        w.putInt(carX[i]);
+        w.putInt(carY[i]);
+        w.putInt(carPrvX[i]);
+        w.putInt(carPrvY[i]);
+        w.putInt(carSpeed[i]);
+        w.putInt(carLane[i]);
+        w.putInt(carTimer[i]);
+        w.putInt(carDelay[i]);
+        w.putBool(carChanging[i] != 0);
+    }
+    w.putVarint(static_cast<uint32_t>(getConeCount()));
+    for(int i = 0; i < getConeCount(); i++) {
+        w.putInt(coneX[i]);
+        w.putInt(coneY[i]);
+        w.putInt(coneSize[i]);
+    }
+}
+
+bool TrafficStore::load(StateReader& r) {
+    // Placeholder values are overwritten field by field below
+    Random scratch;
+    uint32_t cars = r.getVarint();
+    if(cars > (uint32_t)TRAFFIC_MAX) return false;
+    clear();
+    for(uint32_t i = 0; i < cars; i++) {
+        int c = addCar(CENTER_LANE_X, 0, TRAFFIC_COLORS[i % TRAFFIC_AI_CARS],
+                       TRAFFIC_SPEEDS[i % TRAFFIC_AI_CARS], scratch);
+        carX[c] = r.getInt();
+        carY[c] = r.getInt();
+        carPrvX[c] = r.getInt();
+        carPrvY[c] = r.getInt();
+        carSpeed[c] = r.getInt();
+        carLane[c] = r.getInt();
+        carTimer[c] = r.getInt();
+        carDelay[c] = r.getInt();
+        carChanging[c] = r.getBool();
+        if(carLane[c] < LEFT_LANE || carLane[c] > RIGHT_LANE) return false;
+    }
+
+    uint32_t cones = r.getVarint();
+    if(cones > (uint32_t)TRAFFIC_MAX) return false;
+    for(uint32_t i = 0; i < cones; i++) {
+        // Snapshots fall between ticks, where no sweep is pending
+        int x = r.getInt();
+        int y = r.getInt();
+        addCone(x, y, r.getInt());
+    }
+    return true;
+}
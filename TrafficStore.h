@@ -0,0 +1,410 @@
+//================================================================
+// TrafficStore.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Traffic Component Store
+// Description: AI cars and cones of one race kept as separate
+//              contiguous arrays per component, with the movement,
+//              off-screen, respawn and broadphase systems running over
+//              them
+//================================================================
+
+#ifndef TrafficStore_h
+#define TrafficStore_h
+
+#include "Const.h"
+#include "DrawList.h"
+#include "LaneIndex.h"
+#include "Random.h"
+#include "SpatialGrid.h"
+#include "State.h"
+#include <cstdint>
+#include <vector>
+
+class TrafficStore {
+private:
+    // AI CARS, index is update order
+    vector<int>      carX;
+    vector<int>      carY;
+    vector<int>      carPrvX;
+    vector<int>      carPrvY;
+    vector<int>      carSpeed;      // Pixels down the road per tick
+    vector<int>      carSize;
+    vector<int>      carLane;       // Target AILane
+    vector<int>      carTimer;      // Ticks since last lane decision
+    vector<int>      carDelay;      // Ticks between lane decisions
+    vector<uint8_t>  carChanging;   // Shifting toward the target lane
+    vector<color>    carColor;      // Only drawing reads it
+
+    // OBSTACLES, index is update order
+    vector<int>      coneX;
+    vector<int>      coneY;
+    vector<int>      conePrvX;
+    vector<int>      conePrvY;
+    vector<int>      coneSize;
+    vector<int>      coneLeft;      // Packed box edges for the batch
+    vector<int>      coneTop;       // collision kernels
+    vector<int>      coneRight;
+    vector<int>      coneBottom;
+
+    // BROADPHASE, ids are indices above
+    SpatialGrid      carGrid;
+    SpatialGrid      coneGrid;
+
+    /*
+     * Description: LaneRule decision for one car, lanes blocked by the
+     *              lane index
+     * Return: void
+     * Pre-condition: Car due for a decision, lanes built this tick
+     * Post-condition: carLane updated, rng advanced
+     */
+    void decideLane(int i, const LaneIndex& lanes, Random& rng);
+
+    /*
+     * Description: Lane decision, when due, then one steering step toward
+     *              the target lane, for one moved car
+     * Return: void
+     * Pre-condition: Car moved this tick, lanes built this tick
+     * Post-condition: carX, carLane and carChanging updated, rng advanced
+     *                 if a decision was due
+     */
+    void steerCar(int i, const LaneIndex& lanes, Random& rng);
+
+    /*
+     * Description: Work out cone i's packed box from its position and
+     *              size
+     * Return: void
+     * Pre-condition: 0 <= i < getConeCount()
+     * Post-condition: Edges size / 2 around the center
+     */
+    void packCone(int i);
+
+    /*
+     * Description: Drop a car; the last car takes its index
+     * Return: void
+     * Pre-condition: 0 <= i < getCarCount()
+     * Post-condition: One car fewer, grid no longer holds the last id
+     */
+    void removeCar(int i);
+
+public:
+    /*
+     * Description: Make room for a number of cars and cones up front
+     * Return: void
+     * Pre-condition: cars, cones >= 0
+     * Post-condition: Up to that much traffic lives without reallocation
+     */
+    void reserve(int cars, int cones);
+
+    /*
+     * Description: Remove all traffic
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Store and grids empty, storage kept
+     */
+    void clear();
+
+    /*
+     * Description: Add an AI car; x is replaced by a random lane
+     * Return: int - its index
+     * Pre-condition: rng is the game's
+     * Post-condition: Car placed in a random lane at y, rng advanced
+     */
+    int addCar(int x, int y, color look, int speed, Random& rng);
+
+    /*
+     * Description: Add a cone
+     * Return: int - its index
+     * Pre-condition: size > 0
+     * Post-condition: Cone at x, y
+     */
+    int addCone(int x, int y, int size);
+
+    /*
+     * Description: Take a cone off the road; the last cone takes its
+     *              index
+     * Return: void
+     * Pre-condition: 0 <= i < getConeCount()
+     * Post-condition: One cone fewer, grid no longer holds the last id
+     */
+    void removeCone(int i);
+
+    /*
+     * Description: Add traffic until the targets are met, each new car
+     *              and cone spawning above the screen
+     * Return: void
+     * Pre-condition: rng is the game's
+     * Post-condition: At least cars cars and cones cones live
+     */
+    void spawn(int cars, int cones, Random& rng);
+
+    /*
+     * Description: Reposition a car at the top of the road
+     * Return: void
+     * Pre-condition: 0 <= i < getCarCount(), rng is the game's
+     * Post-condition: Random lane and height above the screen, timer reset
+     */
+    void respawnCar(int i, Random& rng);
+
+    /*
+     * Description: Reposition a cone at the top of the road
+     * Return: void
+     * Pre-condition: 0 <= i < getConeCount(), rng is the game's
+     * Post-condition: Random x and height above the screen
+     */
+    void respawnCone(int i, Random& rng);
+
+    /*
+     * Description: Advance every AI car one tick: move, decide lanes,
+     *              steer, then respawn those past the bottom, or drop them
+     *              while there are more than target
+     * Return: int - cars that left the screen
+     * Pre-condition: lanes built from this tick's cones, rng is the game's
+     * Post-condition: Cars moved and steered, rng advanced in index
+     *                 order
+     */
+    int updateCars(const LaneIndex& lanes, Random& rng, int target);
+
+    /*
+     * Description: Advance one AI car one tick: move, decide its lane,
+     *              steer; as updateCars does for each car
+     * Return: void
+     * Pre-condition: 0 <= i < getCarCount(), lanes built from this tick's
+     *                cones, rng is the game's
+     * Post-condition: Car moved and steered, rng advanced
+     */
+    void updateCar(int i, const LaneIndex& lanes, Random& rng);
+
+    /*
+     * Description: Advance every cone one tick, then respawn those past
+     *              the bottom, or drop them while there are more than target
+     * Return: int - cones that left the screen
+     * Pre-condition: rng is the game's
+     * Post-condition: Cones moved, rng advanced in index order
+     */
+    int updateCones(int speed, Random& rng, int target);
+
+    /*
+     * Description: Advance one cone one tick, as updateCones does for
+     *              each cone
+     * Return: void
+     * Pre-condition: 0 <= i < getConeCount()
+     * Post-condition: Cone and its packed box moved down by speed
+     */
+    void updateCone(int i, int speed);
+
+    /*
+     * Description: Refile traffic in the grids; reach covers the last
+     *              move too, for swept queries
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Every car and cone placed by index
+     */
+    void updateGrids();
+
+    /*
+     * Description: Record cones and cars, alpha of the way through
+     *              their last moves
+     * Return: void
+     * Pre-condition: 0 <= alpha <= 1
+     * Post-condition: Cones appended on LAYER_OBSTACLES, cars on
+     *                 LAYER_CARS
+     */
+    void draw(DrawList& list, double alpha = 1.0) const;
+
+    /*
+     * Description: Record one AI car, alpha of the way through its last move
+     * Return: void
+     * Pre-condition: 0 <= i < getCarCount(), 0 <= alpha <= 1
+     * Post-condition: Car appended on LAYER_CARS
+     */
+    void drawCar(int i, DrawList& list, double alpha = 1.0) const;
+
+    /*
+     * Description: Record one cone, alpha of the way through its last move
+     * Return: void
+     * Pre-condition: 0 <= i < getConeCount(), 0 <= alpha <= 1
+     * Post-condition: Cone appended on LAYER_OBSTACLES
+     */
+    void drawCone(int i, DrawList& list, double alpha = 1.0) const;
+
+    /*
+     * Description: Append traffic to a snapshot, cars then cones, each
+     *              kind after its count
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: State encoded into w
+     */
+    void save(StateWriter& w) const;
+
+    /*
+     * Description: Restore traffic from a snapshot; car colors follow
+     *              saved order
+     * Return: bool - false if a count exceeds TRAFFIC_MAX or a lane is
+     *                out of range
+     * Pre-condition: r positioned at data written by save()
+     * Post-condition: Traffic replaced, grids emptied, r advanced
+     */
+    bool load(StateReader& r);
+
+    /*
+     * Description: Get number of AI cars
+     * Return: int - car count
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    int getCarCount() const { return (int)carX.size(); }
+
+    /*
+     * Description: Get number of cones
+     * Return: int - cone count
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    int getConeCount() const { return (int)coneX.size(); }
+
+    /*
+     * Description: Get car i's position
+     * Return: point - center
+     * Pre-condition: 0 <= i < getCarCount()
+     * Post-condition: No state change
+     */
+    point getCarLoc(int i) const { return point(carX[i], carY[i]); }
+
+    /*
+     * Description: Get car i's position before its last move
+     * Return: point - previous center
+     * Pre-condition: 0 <= i < getCarCount()
+     * Post-condition: No state change
+     */
+    point getCarPrvLoc(int i) const { return point(carPrvX[i], carPrvY[i]); }
+
+    /*
+     * Description: Get car i's size
+     * Return: int - width/height in pixels
+     * Pre-condition: 0 <= i < getCarCount()
+     * Post-condition: No state change
+     */
+    int getCarSize(int i) const { return carSize[i]; }
+
+    /*
+     * Description: Get car i's speed
+     * Return: int - pixels down the road per tick
+     * Pre-condition: 0 <= i < getCarCount()
+     * Post-condition: No state change
+     */
+    int getCarSpeed(int i) const { return carSpeed[i]; }
+
+    /*
+     * Description: Check if car i moved below the visible area
+     * Return: bool - true if off screen, false otherwise
+     * Pre-condition: 0 <= i < getCarCount()
+     * Post-condition: No state change
+     */
+    bool isCarOffScreen(int i) const { return carY[i] > COL + carSize[i]; }
+
+    /*
+     * Description: Get cone i's position
+     * Return: point - center
+     * Pre-condition: 0 <= i < getConeCount()
+     * Post-condition: No state change
+     */
+    point getConeLoc(int i) const { return point(coneX[i], coneY[i]); }
+
+    /*
+     * Description: Get cone i's position before its last move
+     * Return: point - previous center
+     * Pre-condition: 0 <= i < getConeCount()
+     * Post-condition: No state change
+     */
+    point getConePrvLoc(int i) const { return point(conePrvX[i], conePrvY[i]); }
+
+    /*
+     * Description: Get cone i's size
+     * Return: int - size in pixels
+     * Pre-condition: 0 <= i < getConeCount()
+     * Post-condition: No state change
+     */
+    int getConeSize(int i) const { return coneSize[i]; }
+
+    /*
+     * Description: Check if cone i moved below the visible area
+     * Return: bool - true if off screen, false otherwise
+     * Pre-condition: 0 <= i < getConeCount()
+     * Post-condition: No state change
+     */
+    bool isConeOffScreen(int i) const { return coneY[i] > COL + coneSize[i]; }
+
+    /*
+     * Description: Get the car broadphase grid
+     * Return: const SpatialGrid& - cars by index
+     * Pre-condition: updateGrids called since traffic last moved
+     * Post-condition: No state change
+     */
+    const SpatialGrid& getCarGrid() const { return carGrid; }
+
+    /*
+     * Description: Get the cone broadphase grid
+     * Return: const SpatialGrid& - cones by index
+     * Pre-condition: updateGrids called since traffic last moved
+     * Post-condition: No state change
+     */
+    const SpatialGrid& getConeGrid() const { return coneGrid; }
+
+    /*
+     * Description: Get the car x positions for the batch kernels
+     * Return: const int* - getCarCount() centers
+     * Pre-condition: None
+     * Post-condition: No state change; valid until traffic is added
+     */
+    const int* getCarXs() const { return carX.data(); }
+
+    /*
+     * Description: Get the car y positions for the batch kernels
+     * Return: const int* - getCarCount() centers
+     * Pre-condition: None
+     * Post-condition: No state change; valid until traffic is added
+     */
+    const int* getCarYs() const { return carY.data(); }
+
+    /*
+     * Description: Get the car sizes for the batch kernels
+     * Return: const int* - getCarCount() sizes
+     * Pre-condition: None
+     * Post-condition: No state change; valid until traffic is added
+     */
+    const int* getCarSizes() const { return carSize.data(); }
+
+    /*
+     * Description: Get the packed cone left edges for the batch kernels
+     * Return: const int* - getConeCount() edges
+     * Pre-condition: None
+     * Post-condition: No state change; valid until traffic is added
+     */
+    const int* getConeLefts() const { return coneLeft.data(); }
+
+    /*
+     * Description: Get the packed cone top edges for the batch kernels
+     * Return: const int* - getConeCount() edges
+     * Pre-condition: None
+     * Post-condition: No state change; valid until traffic is added
+     */
+    const int* getConeTops() const { return coneTop.data(); }
+
+    /*
+     * Description: Get the packed cone right edges for the batch kernels
+     * Return: const int* - getConeCount() edges
+     * Pre-condition: None
+     * Post-condition: No state change; valid until traffic is added
+     */
+    const int* getConeRights() const { return coneRight.data(); }
+
+    /*
+     * Description: Get the packed cone bottom edges for the batch kernels
+     * Return: const int* - getConeCount() edges
+     * Pre-condition: None
+     * Post-condition: No state change; valid until traffic is added
+     */
+    const int* getConeBottoms() const { return coneBottom.data(); }
+};
+
+#endif /* TrafficStore_h */
@@ -6,230 +6,232 @@
 //===================================================================
 
 #include <iostream>
-#include <vector>
 #include <cstdlib>
 #include <ctime>
 #include <cctype>
+#include <chrono>
 #include <string>
+#include <vector>
+#include <memory>
 #include "SDL_Plotter.h"
-#include "Car.h"
-#include "Background.h"
-#include "Collision.h"
-#include "Screen.h"
-#include "Points.h"
+#include "BandRenderer.h"
+#include "Game.h"
+#include "Replay.h"
 #include "Const.h"
 
 using namespace std;
 
-int main(int argc, char **argv) {
-    // Initialize random seed
-    srand((unsigned)time(0));
-
-    // Initialize SDL and game objects
-    SDL_Plotter g(ROW, COL);
-    PlayerCar playerCar(PLAYER_START_X, PLAYER_START_Y, PLAYER_CAR);
-    Background bg;
-    PointsManager points;
-
-    // Initialize AI cars and obstacles
-    vector<AICar> aiCars = {
-        AICar(LEFT_LANE_X,   -50,  AI_BLUE,  4),
-        AICar(CENTER_LANE_X, -150, AI_GREEN, 3),
-        AICar(RIGHT_LANE_X,  -250, AI_YELLOW,5)
-    };
-    vector<Obstacle> obstacles = {
-        Obstacle(LEFT_LANE_X,   -100, OBSTACLE_SIZE),
-        Obstacle(CENTER_LANE_X, -300, OBSTACLE_SIZE),
-        Obstacle(RIGHT_LANE_X,  -500, OBSTACLE_SIZE)
-    };
-
-    // Game state management
-    GameState gameState = STATE_START;
-    StartScreen startScreen;
-    InstructionsScreen instructionsScreen;
-    PauseScreen pauseScreen;
-    GameOverScreen gameOverScreen;
-    WinScreen winScreen;
-
-    int collisionCooldown = 0;
-    int frameCount = 0;
+/*
+ * Description: Play recorded sessions back at full speed, no rendering
+ * Return: int - process exit code, nonzero if any log failed to load
+ * Pre-condition: paths name replay logs
+ * Post-condition: One summary line printed per log
+ */
+static int runReplays(const vector<string>& paths) {
+    typedef chrono::steady_clock Clock;
+    int status = 0;
+
+    for (const string& path : paths) {
+        ReplayPlayer player;
+        if (!player.load(path)) {
+            cerr << path << ": not a valid replay" << endl;
+            status = 1;
+            continue;
+        }
+
+        Game game(player.getSeed());
+        Clock::time_point start = Clock::now();
+        bool inSync = player.run(game);
+        double secs = chrono::duration<double>(Clock::now() - start).count();
+
+        cout << path
+             << " seed=" << player.getSeed()
+             << " ticks=" << game.getTick()
+             << " inputs=" << player.getEventCount()
+             << " state=" << game.getState()
+             << " score=" << game.getPoints().getScore()
+             << " ticks/s=" << (secs > 0 ? (long long)(game.getTick() / secs) : 0)
+             << (inSync ? "" : " DESYNC")
+             << endl;
+        if (!inSync) status = 1;
+    }
+    return status;
+}
+
+/*
+ * Description: Draw the current frame, racing frames recorded once and
+ *              replayed into each of the renderer's bands when there is one
+ * Return: void
+ * Pre-condition: bands is null or owned by the caller, 0 <= alpha <= 1
+ * Post-condition: Frame drawn into g, race movement alpha of the way
+ *                 through the last tick
+ */
+static void drawFrame(Game& game, SDL_Plotter& g, BandRenderer* bands, double alpha) {
+    // Menu screens track their static layer as they draw: one thread only
+    if (bands && game.getState() == STATE_PLAYING) {
+        const DrawList& list = game.recordRace(alpha);
+        bands->render(g, [&list](SDL_Plotter& band) { list.execute(band); });
+    } else {
+        game.draw(g, alpha);
+    }
+}
+
+/*
+ * Description: Watch a recorded session in a window. LEFT/RIGHT jump
+ *              one keyframe interval back/forward, P pauses.
+ * Return: int - process exit code, nonzero if the log failed to load
+ * Pre-condition: path names a replay log
+ * Post-condition: Window closed when the viewer quits
+ */
+static int runViewer(const string& path, int startTick, PlotterMode mode, BandRenderer* bands) {
+    ReplayPlayer player;
+    if (!player.load(path)) {
+        cerr << path << ": not a valid replay" << endl;
+        return 1;
+    }
+
+    SDL_Plotter g(ROW, COL, true, mode);
+    Game game(player.getSeed());
+    player.seek(game, startTick);
+    bool paused = false;
+    GameState shown = STATE_PLAYING;
 
-    // Main game loop
     while (!g.getQuit()) {
-        // Handle input
         if (g.kbhit()) {
             char c = toupper(g.getKey());
-
-            switch (gameState) {
-                case STATE_START:
-                    if (c == 'I') {
-                        gameState = STATE_INSTRUCTIONS;
-                    } else if (startScreen.handleInput(c)) {
-                        gameState = STATE_PLAYING;
-                    }
-                    break;
-
-                case STATE_INSTRUCTIONS:
-                    if (c == 'S')      gameState = STATE_PLAYING;
-                    else if (c == 'B') gameState = STATE_START;
-                    break;
-
-                case STATE_PLAYING:
-                    switch(c) {
-                        case RIGHT_ARROW: playerCar.move(RIGHT_ARROW); break;
-                        case LEFT_ARROW:  playerCar.move(LEFT_ARROW);  break;
-                        case UP_ARROW:    playerCar.move(UP_ARROW);    break;
-                        case DOWN_ARROW:  playerCar.move(DOWN_ARROW);  break;
-                        case 'P':         gameState = STATE_PAUSED;    break;
-                    }
-                    break;
-
-                case STATE_PAUSED:
-                    if (pauseScreen.handleInput(c)) {
-                        gameState = STATE_PLAYING;
-                    } else if (c == 'B') {
-                        gameState = STATE_START;
-                    }
-                    break;
-
-                case STATE_GAME_OVER:
-                    if (gameOverScreen.handleInput(c)) {
-                        // Restart game
-                        playerCar.respawn();
-                        bg = Background();
-                        points.reset();
-                        collisionCooldown = 0;
-                        frameCount = 0;
-
-                        for (auto& ai : aiCars) ai.respawn();
-                        for (auto& obs : obstacles) obs.respawn();
-
-                        gameState = STATE_START;
-                    }
-                    break;
-
-                case STATE_WIN:
-                    if (winScreen.handleInput(c)) {
-                        // Restart game
-                        playerCar.respawn();
-                        bg = Background();
-                        points.reset();
-                        collisionCooldown = 0;
-                        frameCount = 0;
-
-                        for (auto& ai : aiCars) ai.respawn();
-                        for (auto& obs : obstacles) obs.respawn();
-
-                        gameState = STATE_START;
-                    }
-                    break;
+            if (c == LEFT_ARROW) {
+                player.seek(game, game.getTick() - REPLAY_KEYFRAME_INTERVAL);
+            } else if (c == RIGHT_ARROW) {
+                player.seek(game, game.getTick() + REPLAY_KEYFRAME_INTERVAL);
+            } else if (c == 'P') {
+                paused = !paused;
             }
         }
 
-        if (g.mouseClick()) {
-            g.getMouseClick(); // Clear click queue
+        if (!paused && game.getTick() < player.getEndTick()) {
+            player.seek(game, game.getTick() + 1);
+        }
+
+        // Seeking restores screens from a keyframe, which redraws their
+        // static layers; an idle menu only redraws its flashing lines
+        g.setIncremental(game.getState() == shown && shown != STATE_PLAYING);
+        drawFrame(game, g, bands, 1.0);
+        shown = game.getState();
+        g.update();
+        g.Sleep(TICK_MS);
+    }
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    // Command line: --record FILE, --replay FILE [FILE ...],
+    //               --view FILE [--seek TICK], --streaming, --threads N
+    string recordPath, viewPath;
+    vector<string> replayPaths;
+    int seekTick = 0;
+    PlotterMode mode = PLOTTER_WINDOW;
+    int threads = 1;
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "--record" && i + 1 < argc) {
+            recordPath = argv[++i];
+        } else if (arg == "--replay") {
+            while (i + 1 < argc && argv[i + 1][0] != '-') replayPaths.push_back(argv[++i]);
+        } else if (arg == "--view" && i + 1 < argc) {
+            viewPath = argv[++i];
+        } else if (arg == "--seek" && i + 1 < argc) {
+            seekTick = atoi(argv[++i]);
+        } else if (arg == "--streaming") {
+            mode = PLOTTER_STREAMING;
+        } else if (arg == "--threads" && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+        } else {
+            cerr << "usage: " << argv[0] << " [--record FILE] [--replay FILE...]"
+                 << " [--view FILE [--seek TICK]] [--streaming] [--threads N]" << endl;
+            return 1;
         }
+    }
+
+    if (!replayPaths.empty()) {
+        return runReplays(replayPaths);
+    }
+    // Race frames drawn in horizontal bands, one thread each
+    unique_ptr<BandRenderer> bands;
+    if (threads > 1) bands.reset(new BandRenderer(threads));
+
+    if (!viewPath.empty()) {
+        return runViewer(viewPath, seekTick, mode, bands.get());
+    }
+
+    // Initialize SDL and game, seeded from the clock
+    SDL_Plotter g(ROW, COL, true, mode);
+    Game game((uint64_t)time(0));
+
+    ReplayRecorder recorder;
+    if (!recordPath.empty() && !recorder.open(recordPath, game.getSeed())) {
+        cerr << "could not record to " << recordPath << endl;
+    }
+
+    // Fixed-timestep scheduling: the simulation always advances in
+    // TICK_MS steps, rendering happens once per pass of the loop, up to
+    // RENDER_FPS_TARGET times a second. Between ticks, race frames show
+    // movement lag / TICK_MS of the way through the last tick.
+    typedef chrono::steady_clock Clock;
+    Clock::time_point previous = Clock::now();
+    double lag = 0.0;
+
+    // State on screen; racing frames are always drawn in full
+    GameState shown = STATE_PLAYING;
 
-        g.clear();
-
-        // Update and draw based on game state
-        switch (gameState) {
-            case STATE_START:
-                startScreen.update();
-                startScreen.draw(g);
-                break;
-
-            case STATE_INSTRUCTIONS:
-                instructionsScreen.update();
-                instructionsScreen.draw(g);
-                break;
-
-            case STATE_PAUSED:
-                pauseScreen.update();
-                pauseScreen.draw(g);
-                break;
-
-            case STATE_GAME_OVER:
-                gameOverScreen.update();
-                gameOverScreen.draw(g);
-                break;
-
-            case STATE_WIN:
-                winScreen.update();
-                winScreen.draw(g);
-                break;
-
-            case STATE_PLAYING: {
-                // Update game logic
-                bg.update(playerCar.getSpeed());
-                points.updateSpeed(playerCar.getSpeed());
-                points.update();
-                playerCar.update(bg.getOffset()); // currently does nothing (input-driven)
-
-                // Update AI and obstacles
-                for (auto& ai : aiCars) {
-                    ai.update(bg.getOffset(), obstacles);   // obstacle-aware AI
-                    if (ai.isOffScreen()) {
-                        ai.respawn();
-                        points.addCarPass();
-                    }
-                }
-
-                for (auto& obs : obstacles) {
-                    obs.update(playerCar.getSpeed());
-                    if (obs.isOffScreen()) {
-                        obs.respawn();
-                        points.addObstacleAvoided();
-                    }
-                }
-
-                // Collision detection
-                if (collisionCooldown <= 0) {
-                    bool hitAI = false, hitObstacle = false;
-                    Collision::checkAllCollisions(playerCar, aiCars, obstacles,
-                                                  hitAI, hitObstacle);
-
-                    if (hitAI || hitObstacle) {
-                        playerCar.setSpeed(max(MIN_SPEED, playerCar.getSpeed() - COLLISION_SPEED_PENALTY));
-                        int newScore = max(0, points.getScore() - COLLISION_POINTS_PENALTY);
-                        gameOverScreen.setGameOver(newScore, hitAI, hitObstacle);
-                        gameState = STATE_GAME_OVER;
-                    }
-                } else {
-                    collisionCooldown--;
-                }
-
-                // Win condition
-                if (points.getScore() >= POINTS_PER_LAP * MAX_LAPS) {
-                    winScreen.setWin(points.getScore());
-                    gameState = STATE_WIN;
-                }
-
-                // Draw scene
-                bg.draw(g);
-                for (auto& obs : obstacles) obs.draw(g);
-                for (auto& ai : aiCars) ai.draw(g);
-                playerCar.draw(g);
-
-                // Draw HUD
-                {
-                    color hudColor(255, 255, 255);
-                    string scoreStr = "Score: " + to_string(points.getScore());
-                    string speedStr = "Speed: " + to_string(playerCar.getSpeed());
-                    FontRenderer::drawSmall(g, 10, 20, hudColor, scoreStr, 0);
-                    FontRenderer::drawSmall(g, 10, 50, hudColor, speedStr, 0);
-                }
-
-                frameCount++;
-                break;
+    // Main game loop
+    while (!g.getQuit()) {
+        Clock::time_point now = Clock::now();
+        lag += chrono::duration<double, milli>(now - previous).count();
+        previous = now;
+
+        // Catch up on missed ticks, one queued key per tick
+        int ticks = 0;
+        bool steady = true;
+        while (lag >= TICK_MS && ticks < MAX_CATCHUP_TICKS) {
+            if (game.getTick() % REPLAY_KEYFRAME_INTERVAL == 0) {
+                recorder.recordKeyframe(game);
             }
+            char c = g.kbhit() ? toupper(g.getKey()) : '\0';
+            if (c != '\0') recorder.record(game.getTick(), c);
+            game.handleInput(c);
+            game.tick();
+            steady = steady && game.getState() == shown;
+            lag -= TICK_MS;
+            ticks++;
+        }
+
+        // Too far behind: drop the backlog instead of spiralling
+        if (lag >= TICK_MS) {
+            lag = 0.0;
         }
 
-        g.Sleep(FRAME_DELAY_MS);
+        if (g.mouseClick()) {
+            g.getMouseClick(); // Clear click queue
+        }
+
+        // A menu left alone only animates its flashing lines: keep the
+        // last frame and let the screen redraw just those
+        g.setIncremental(steady && game.getState() == shown && shown != STATE_PLAYING);
+        drawFrame(game, g, bands.get(), lag / TICK_MS);
+        shown = game.getState();
         g.update();
+
+        // Sleep until the next frame is due, or the next tick if sooner
+        double spent = chrono::duration<double, milli>(Clock::now() - previous).count();
+        double remaining = min(TICK_MS - lag, (double)FRAME_MS) - spent;
+        if (remaining >= 1.0) {
+            g.Sleep((int)remaining);
+        }
     }
 
+    recorder.close(game.getTick());
+
     cout << "\n=== PIXEL RACERS ===\n";
-    cout << "Final Score: " << points.getScore() << endl;
+    cout << "Final Score: " << game.getPoints().getScore() << endl;
     return 0;
 }
@@ -0,0 +1,202 @@
+//================================================================
+// batch_sim.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Monte Carlo Batch Simulator
+// Description: Runs many headless games in parallel under a scripted
+//              policy and reports score/survival distributions
+//
+// Build (from repo root):
+//   g++ -std=c++17 -O2 -I. tools/batch_sim.cpp Game.cpp Policy.cpp
+//       TrafficStore.cpp CollisionKernel.cpp SpatialGrid.cpp LaneIndex.cpp
+//       Car.cpp Obstacle.cpp Sprite.cpp DrawList.cpp Background.cpp
+//       Points.cpp Screen.cpp Font.cpp SDL_Plotter.cpp -lSDL2 -lSDL2_mixer
+//       -pthread
+//================================================================
+
+#include "Game.h"
+#include "Policy.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+// How a simulated race ended
+enum Outcome {
+    OUTCOME_HIT_AI,
+    OUTCOME_HIT_OBSTACLE,
+    OUTCOME_HIT_BOTH,
+    OUTCOME_WIN,
+    OUTCOME_TIMEOUT,
+    OUTCOME_COUNT
+};
+
+const char* OUTCOME_NAMES[OUTCOME_COUNT] = {
+    "hit AI", "hit obstacle", "hit both", "win", "timeout"
+};
+
+// One finished game
+struct RunResult {
+    int     score;
+    int     frames;
+    int     carsPassed;
+    int     obstaclesAvoided;
+    Outcome outcome;
+};
+
+// Per-thread bookkeeping for throughput
+struct WorkerStats {
+    long long frames;
+    double    seconds;
+};
+
+/*
+ * Description: Play one race to its end under a policy
+ * Return: RunResult - final counters and cause of the end
+ * Pre-condition: maxFrames > 0, 0 <= traffic <= TRAFFIC_MAX
+ * Post-condition: No shared state touched
+ */
+static RunResult playOne(uint64_t seed, const string& policyName, int maxFrames, int traffic) {
+    Game game(seed);
+    game.setTraffic(traffic, traffic);
+    unique_ptr<PlayerPolicy> policy = makePolicy(policyName, seed);
+
+    game.handleInput('S');
+    while (game.getState() == STATE_PLAYING && game.getFrameCount() < maxFrames) {
+        game.handleInput(policy->decide(game));
+        game.tick();
+    }
+
+    RunResult r;
+    r.score = game.getPoints().getScore();
+    r.frames = game.getFrameCount();
+    r.carsPassed = game.getPoints().getCarsPassed();
+    r.obstaclesAvoided = game.getPoints().getObstaclesAvoided();
+
+    if (game.getState() == STATE_WIN) {
+        r.outcome = OUTCOME_WIN;
+    } else if (game.getState() != STATE_GAME_OVER) {
+        r.outcome = OUTCOME_TIMEOUT;
+    } else if (game.getHitAI() && game.getHitObstacle()) {
+        r.outcome = OUTCOME_HIT_BOTH;
+    } else {
+        r.outcome = game.getHitAI() ? OUTCOME_HIT_AI : OUTCOME_HIT_OBSTACLE;
+    }
+    return r;
+}
+
+/*
+ * Description: Print mean, spread and percentiles of one metric
+ * Return: void
+ * Pre-condition: values not empty
+ * Post-condition: values sorted
+ */
+static void printDistribution(const char* name, vector<int>& values) {
+    sort(values.begin(), values.end());
+    double sum = 0, sq = 0;
+    for (int v : values) { sum += v; sq += (double)v * v; }
+    double n = (double)values.size();
+    double mean = sum / n;
+    double sd = sqrt(max(0.0, sq / n - mean * mean));
+    auto pct = [&](double p) { return values[(size_t)(p * (values.size() - 1))]; };
+
+    printf("%-18s mean %9.1f  sd %8.1f  min %6d  p10 %6d  p50 %6d  p90 %6d  max %6d\n",
+           name, mean, sd, values.front(), pct(0.10), pct(0.50), pct(0.90), values.back());
+}
+
+int main(int argc, char** argv) {
+    int games = 1000;
+    int threads = (int)thread::hardware_concurrency();
+    int maxFrames = 20000;
+    uint64_t baseSeed = 1;
+    string policyName = "dodge";
+    int traffic = TRAFFIC_AI_CARS;
+
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "--games" && i + 1 < argc)           games = atoi(argv[++i]);
+        else if (arg == "--threads" && i + 1 < argc)    threads = atoi(argv[++i]);
+        else if (arg == "--max-frames" && i + 1 < argc) maxFrames = atoi(argv[++i]);
+        else if (arg == "--seed" && i + 1 < argc)       baseSeed = strtoull(argv[++i], nullptr, 10);
+        else if (arg == "--policy" && i + 1 < argc)     policyName = argv[++i];
+        else if (arg == "--traffic" && i + 1 < argc) {
+            string n = argv[++i];
+            traffic = n == "stress" ? TRAFFIC_STRESS : max(0, min(atoi(n.c_str()), TRAFFIC_MAX));
+        }
+        else {
+            cerr << "usage: " << argv[0] << " [--games N] [--threads T] [--policy idle|random|dodge]"
+                 << " [--seed S] [--max-frames F] [--traffic N|stress]" << endl;
+            return 1;
+        }
+    }
+    if (!makePolicy(policyName, 0)) {
+        cerr << "unknown policy " << policyName << endl;
+        return 1;
+    }
+    threads = max(1, min(threads, games));
+
+    // WORK QUEUE: threads pull game indices, results land in fixed slots
+    vector<RunResult> results(games);
+    vector<WorkerStats> stats(threads);
+    atomic<int> nextGame(0);
+
+    typedef chrono::steady_clock Clock;
+    Clock::time_point start = Clock::now();
+
+    vector<thread> workers;
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&, t]() {
+            Clock::time_point begin = Clock::now();
+            long long frames = 0;
+            for (int i = nextGame++; i < games; i = nextGame++) {
+                results[i] = playOne(baseSeed + i, policyName, maxFrames, traffic);
+                frames += results[i].frames;
+            }
+            stats[t].frames = frames;
+            stats[t].seconds = chrono::duration<double>(Clock::now() - begin).count();
+        });
+    }
+    for (thread& w : workers) w.join();
+    double wall = chrono::duration<double>(Clock::now() - start).count();
+
+    // DISTRIBUTIONS
+    vector<int> scores, frames, passed, avoided;
+    int outcomes[OUTCOME_COUNT] = {0};
+    long long totalFrames = 0;
+    for (const RunResult& r : results) {
+        scores.push_back(r.score);
+        frames.push_back(r.frames);
+        passed.push_back(r.carsPassed);
+        avoided.push_back(r.obstaclesAvoided);
+        outcomes[r.outcome]++;
+        totalFrames += r.frames;
+    }
+
+    printf("=== PIXEL RACERS BATCH: %d games, policy %s, %d threads, traffic %d ===\n",
+           games, policyName.c_str(), threads, traffic);
+    printDistribution("score", scores);
+    printDistribution("frames survived", frames);
+    printDistribution("cars passed", passed);
+    printDistribution("obstacles avoided", avoided);
+
+    printf("\nend of race:\n");
+    for (int o = 0; o < OUTCOME_COUNT; o++) {
+        printf("  %-13s %7d  (%5.1f%%)\n", OUTCOME_NAMES[o], outcomes[o], 100.0 * outcomes[o] / games);
+    }
+
+    double perCore = 0;
+    for (const WorkerStats& s : stats) {
+        if (s.seconds > 0) perCore += s.frames / s.seconds;
+    }
+    perCore /= threads;
+    printf("\nthroughput: %.0f frames/s total, %.0f frames/s per thread, %.3f s wall\n",
+           wall > 0 ? totalFrames / wall : 0.0, perCore, wall);
+    return 0;
+}
@@ -0,0 +1,164 @@
+//================================================================
+// batch_step.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Batched Engine Benchmark
+// Description: Steps many races through BatchEngine under random
+//              actions, restarting each race with a fresh seed when it
+//              ends, checks them against Game and compares speed
+//
+// Build (from repo root):
+//   g++ -std=c++17 -O2 -I. tools/batch_step.cpp BatchEngine.cpp
+//       Game.cpp TrafficStore.cpp CollisionKernel.cpp SpatialGrid.cpp
+//       LaneIndex.cpp RaceEnv.cpp Car.cpp Obstacle.cpp Sprite.cpp DrawList.cpp Background.cpp
+//       Points.cpp Screen.cpp Font.cpp SDL_Plotter.cpp -lSDL2 -lSDL2_mixer
+//       -pthread
+//================================================================
+
+#include "BatchEngine.h"
+#include "Game.h"
+#include "Random.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Key Game::handleInput sees for each RaceAction
+static const char ACTION_KEYS[ACTION_COUNT] = {
+    '\0', LEFT_ARROW, RIGHT_ARROW, UP_ARROW, DOWN_ARROW
+};
+
+/*
+ * Description: Pick this tick's action for every race
+ * Return: void
+ * Pre-condition: actions and drivers sized to the race count
+ * Post-condition: Each driver advanced once
+ */
+static void chooseActions(vector<Random>& drivers, vector<uint8_t>& actions) {
+    for (size_t k = 0; k < drivers.size(); k++) {
+        int roll = drivers[k].nextInt(10);
+        actions[k] = static_cast<uint8_t>(roll < ACTION_COUNT ? roll : 0);
+    }
+}
+
+int main(int argc, char** argv) {
+    int races = 4096;
+    int ticks = 2000;
+    uint64_t baseSeed = 1;
+    bool verify = false;
+
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "--races" && i + 1 < argc)      races = atoi(argv[++i]);
+        else if (arg == "--ticks" && i + 1 < argc) ticks = atoi(argv[++i]);
+        else if (arg == "--seed" && i + 1 < argc)  baseSeed = strtoull(argv[++i], nullptr, 10);
+        else if (arg == "--verify")                verify = true;
+        else {
+            cerr << "usage: " << argv[0] << " [--races K] [--ticks T] [--seed S] [--verify]" << endl;
+            return 1;
+        }
+    }
+    races = max(1, races);
+    ticks = max(1, ticks);
+
+    typedef chrono::steady_clock Clock;
+    vector<uint8_t> actions(races);
+    vector<Random> drivers(races);
+
+    // BATCHED
+    BatchEngine engine(races);
+    uint64_t nextSeed = baseSeed;
+    for (int k = 0; k < races; k++) {
+        engine.reset(k, nextSeed);
+        drivers[k].setSeed(nextSeed++);
+    }
+
+    long long episodes = 0, scoreSum = 0;
+    int over = 0, won = 0;
+    Clock::time_point start = Clock::now();
+    for (int t = 0; t < ticks; t++) {
+        chooseActions(drivers, actions);
+        engine.step(actions.data());
+        for (int k = 0; k < races; k++) {
+            if (engine.isPlaying(k)) continue;
+            episodes++;
+            scoreSum += engine.getScore(k);
+            if (engine.getState(k) == STATE_WIN) won++;
+            else over++;
+            engine.reset(k, nextSeed);
+            drivers[k].setSeed(nextSeed++);
+        }
+    }
+    double batchSeconds = chrono::duration<double>(Clock::now() - start).count();
+
+    // ONE GAME AT A TIME, same seeds and actions
+    vector<unique_ptr<Game>> games;
+    BatchEngine check(races);
+    nextSeed = baseSeed;
+    for (int k = 0; k < races; k++) {
+        games.emplace_back(new Game(nextSeed));
+        games[k]->handleInput('S');
+        check.reset(k, nextSeed);
+        drivers[k].setSeed(nextSeed++);
+    }
+
+    long long mismatches = 0;
+    int firstBad = -1, firstBadTick = -1;
+    start = Clock::now();
+    for (int t = 0; t < ticks; t++) {
+        chooseActions(drivers, actions);
+        for (int k = 0; k < races; k++) {
+            Game& game = *games[k];
+            game.handleInput(ACTION_KEYS[actions[k]]);
+            game.tick();
+        }
+
+        // Lockstep comparison is kept out of the Game timing
+        Clock::time_point pause = Clock::now();
+        if (verify) {
+            check.step(actions.data());
+            for (int k = 0; k < races; k++) {
+                if (!check.matches(k, *games[k])) {
+                    if (firstBad < 0) { firstBad = k; firstBadTick = t; }
+                    mismatches++;
+                }
+            }
+        }
+        start += Clock::now() - pause;
+
+        for (int k = 0; k < races; k++) {
+            Game& game = *games[k];
+            if (game.getState() == STATE_PLAYING) continue;
+            game.reset(nextSeed);
+            game.handleInput('S');
+            if (verify) check.reset(k, nextSeed);
+            drivers[k].setSeed(nextSeed++);
+        }
+    }
+    double gameSeconds = chrono::duration<double>(Clock::now() - start).count();
+
+    long long raceTicks = (long long)races * ticks;
+    printf("=== PIXEL RACERS BATCH STEP: %d races x %d ticks ===\n", races, ticks);
+    printf("episodes %lld (game over %d, win %d), mean score %.1f\n",
+           episodes, over, won, episodes > 0 ? (double)scoreSum / episodes : 0.0);
+    printf("BatchEngine: %.3f s (%.0f race-ticks/s)\n",
+           batchSeconds, batchSeconds > 0 ? raceTicks / batchSeconds : 0.0);
+    printf("Game:        %.3f s (%.0f race-ticks/s)\n",
+           gameSeconds, gameSeconds > 0 ? raceTicks / gameSeconds : 0.0);
+
+    if (verify) {
+        if (mismatches == 0) {
+            printf("verify: all races match Game tick for tick\n");
+        } else {
+            printf("verify: %lld mismatched race-ticks, first race %d at tick %d\n",
+                   mismatches, firstBad, firstBadTick);
+            return 2;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,379 @@
+//================================================================
+// bench_collision.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Collision Benchmark
+// Description: Times collision checks and AI lane lookups over growing
+//              traffic, entity by entity with sqrt, through the spatial
+//              grid, through the batch kernels and through the lane
+//              index, and checks they all give the same answers; then
+//              counts cone hits end-of-step and swept tests still catch
+//              as the simulation step grows
+//
+// Build (from repo root):
+//   g++ -std=c++17 -O2 -I. tools/bench_collision.cpp TrafficStore.cpp
+//       CollisionKernel.cpp SpatialGrid.cpp LaneIndex.cpp Car.cpp
+//       Obstacle.cpp Sprite.cpp DrawList.cpp Font.cpp SDL_Plotter.cpp -lSDL2
+//       -lSDL2_mixer -pthread
+//================================================================
+
+#include "Collision.h"
+#include "LaneIndex.h"
+#include "Random.h"
+#include "TrafficStore.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/*
+ * Description: Fill a store with count cars and count cones spread over
+ *              the road and the rows above the screen
+ * Return: void
+ * Pre-condition: traffic is empty
+ * Post-condition: Traffic placed at random
+ */
+static void populate(TrafficStore& traffic, int count, Random& rng) {
+    for(int i = 0; i < count; i++) {
+        int x = ROAD_START + rng.nextInt(ROAD_WIDTH);
+        int y = GRID_TOP + rng.nextInt(COL - GRID_TOP);
+        traffic.addCar(x, y, TRAFFIC_COLORS[i % TRAFFIC_AI_CARS], 3, rng);
+    }
+    for(int i = 0; i < count; i++) {
+        int x = ROAD_START + rng.nextInt(ROAD_WIDTH);
+        int y = GRID_TOP + rng.nextInt(COL - GRID_TOP);
+        traffic.addCone(x, y, OBSTACLE_SIZE);
+    }
+}
+
+/*
+ * Description: Move traffic one tick as Game does, respawning what leaves
+ * Return: void
+ * Pre-condition: None
+ * Post-condition: Cars moved and steered, cones moved by MAX_SPEED
+ */
+static void advance(TrafficStore& traffic, LaneIndex& lanes, Random& rng) {
+    lanes.build(traffic);
+    traffic.updateCars(lanes, rng, traffic.getCarCount());
+    traffic.updateCones(MAX_SPEED, rng, traffic.getConeCount());
+}
+
+/*
+ * Description: First AI car a car overlaps, one car at a time with sqrt
+ * Return: int - index of the hit, -1 if none
+ * Pre-condition: None
+ * Post-condition: No state change
+ */
+static int scanCars(point loc, int size, const TrafficStore& traffic, int skip) {
+    for(int i = 0; i < traffic.getCarCount(); i++) {
+        if(i != skip && Collision::circlesOverlap(loc, size, traffic.getCarLoc(i), traffic.getCarSize(i))) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/*
+ * Description: First cone a car overlaps, one cone at a time with
+ *              its bounds worked out per pair
+ * Return: int - index of the hit, -1 if none
+ * Pre-condition: None
+ * Post-condition: No state change
+ */
+static int scanCones(point loc, int size, const TrafficStore& traffic) {
+    for(int i = 0; i < traffic.getConeCount(); i++) {
+        if(Collision::boxesOverlap(loc, size, traffic.getConeLoc(i), traffic.getConeSize(i))) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/*
+ * Description: Check a car against the AI cars the grid files near it
+ * Return: bool - true if it overlaps any but skip
+ * Pre-condition: traffic.updateGrids called since traffic last moved
+ * Post-condition: No state change
+ */
+static bool gridCars(point loc, int size, const TrafficStore& traffic, int skip) {
+    int half = size / 2;
+    return traffic.getCarGrid().query(loc.x - half, loc.y - half, loc.x + half, loc.y + half, [&](int id) {
+        return id != skip && Collision::circlesOverlap(loc, size, traffic.getCarLoc(id), traffic.getCarSize(id));
+    });
+}
+
+/*
+ * Description: Check a car against the cones the grid files near it
+ * Return: bool - true if it overlaps any
+ * Pre-condition: traffic.updateGrids called since traffic last moved
+ * Post-condition: No state change
+ */
+static bool gridCones(point loc, int size, const TrafficStore& traffic) {
+    int half = size / 2;
+    return traffic.getConeGrid().query(loc.x - half, loc.y - half, loc.x + half, loc.y + half, [&](int id) {
+        return Collision::boxesOverlap(loc, size, traffic.getConeLoc(id), traffic.getConeSize(id));
+    });
+}
+
+/*
+ * Description: First hit of every AI car against the others through the
+ *              current batch kernel
+ * Return: void
+ * Pre-condition: first holds getCarCount() entries
+ * Post-condition: first[i] is car i's first hit, -1 if none
+ */
+static void kernelAllCars(const TrafficStore& traffic, vector<int>& first) {
+    int n = traffic.getCarCount();
+    for(int i = 0; i < n; i++) {
+        point loc = traffic.getCarLoc(i);
+        first[i] = CollisionKernel::firstCircleHit(loc.x, loc.y, traffic.getCarSize(i),
+                                                   traffic.getCarXs(), traffic.getCarYs(),
+                                                   traffic.getCarSizes(), n, i);
+    }
+}
+
+/*
+ * Description: Lane lookahead as a scan over every cone, before the lane
+ *              index
+ * Return: bool - true if a cone sits ahead of y in the lane
+ * Pre-condition: None
+ * Post-condition: No state change
+ */
+static bool linearBlocked(int laneX, int y, const TrafficStore& traffic) {
+    for(int i = 0; i < traffic.getConeCount(); i++) {
+        point loc = traffic.getConeLoc(i);
+        if(abs(loc.x - laneX) <= traffic.getConeSize(i) / 2 &&
+           loc.y > y && loc.y - y < AI_LANE_LOOKAHEAD) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int main(int argc, char** argv) {
+    int ticks = 200;
+    for(int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if(arg == "--ticks" && i + 1 < argc) ticks = max(1, atoi(argv[++i]));
+        else {
+            cerr << "usage: " << argv[0] << " [--ticks T]" << endl;
+            return 1;
+        }
+    }
+
+    typedef chrono::steady_clock Clock;
+    const int COUNTS[] = { 3, 30, 300, 3000 };
+    bool identical = true;
+
+    // PLAYER AND EVERY AI CAR AGAINST THE TRAFFIC: entity by entity with
+    // sqrt, through the grid (refile, then query) and through the kernels
+    printf("=== PIXEL RACERS COLLISION: %d ticks ===\n", ticks);
+    printf("%-8s %9s %9s %9s %9s %12s %12s %12s  %s\n", "entities", "scan us", "refile us",
+           "grid us", "kernel us", "all scan", "all grid", "all kernel", "hits");
+    for(int count : COUNTS) {
+        Random rng(1);
+        TrafficStore traffic;
+        LaneIndex lanes;
+        populate(traffic, count, rng);
+        PlayerCar player(PLAYER_START_X, PLAYER_START_Y, PLAYER_CAR);
+
+        double scan = 0, refile = 0, grid = 0, kernel = 0, allScan = 0, allGrid = 0, allKernel = 0;
+        long long hits = 0;
+        bool same = true;
+        vector<int> scanFirst(count), kernelFirst(count);
+        for(int t = 0; t < ticks; t++) {
+            advance(traffic, lanes, rng);
+            player.move(t / 20 % 2 ? LEFT_ARROW : RIGHT_ARROW);
+            point loc = player.getLoc();
+            int size = player.getSize();
+
+            Clock::time_point start = Clock::now();
+            int scanAI = scanCars(loc, size, traffic, -1);
+            int scanObs = scanCones(loc, size, traffic);
+            Clock::time_point scanned = Clock::now();
+            traffic.updateGrids();
+            Clock::time_point filed = Clock::now();
+            bool gridAI = gridCars(loc, size, traffic, -1);
+            bool gridObs = gridCones(loc, size, traffic);
+            Clock::time_point queried = Clock::now();
+            bool kernelAI, kernelObs;
+            Collision::checkAllCollisions(player, traffic, kernelAI, kernelObs);
+            Clock::time_point end = Clock::now();
+            scan += chrono::duration<double, micro>(scanned - start).count();
+            refile += chrono::duration<double, micro>(filed - scanned).count();
+            grid += chrono::duration<double, micro>(queried - filed).count();
+            kernel += chrono::duration<double, micro>(end - queried).count();
+            same = same && (scanAI >= 0) == gridAI && (scanAI >= 0) == kernelAI &&
+                   (scanObs >= 0) == gridObs && (scanObs >= 0) == kernelObs;
+            hits += (scanAI >= 0) + (scanObs >= 0);
+
+            // EVERY AI CAR AGAINST THE OTHERS, a few ticks only
+            if(t % 50 != 0) continue;
+            start = Clock::now();
+            for(int i = 0; i < count; i++) {
+                scanFirst[i] = scanCars(traffic.getCarLoc(i), traffic.getCarSize(i), traffic, i);
+            }
+            scanned = Clock::now();
+            vector<bool> near(count);
+            for(int i = 0; i < count; i++) {
+                near[i] = gridCars(traffic.getCarLoc(i), traffic.getCarSize(i), traffic, i);
+            }
+            queried = Clock::now();
+            kernelAllCars(traffic, kernelFirst);
+            end = Clock::now();
+            allScan += chrono::duration<double, micro>(scanned - start).count();
+            allGrid += chrono::duration<double, micro>(queried - scanned).count();
+            allKernel += chrono::duration<double, micro>(end - queried).count();
+            same = same && scanFirst == kernelFirst;
+            for(int i = 0; i < count; i++) same = same && (scanFirst[i] >= 0) == near[i];
+        }
+        identical = identical && same;
+
+        int samples = (ticks + 49) / 50;
+        printf("%-8d %9.2f %9.2f %9.2f %9.2f %12.1f %12.1f %12.1f  %lld %s\n", count,
+               scan / ticks, refile / ticks, grid / ticks, kernel / ticks, allScan / samples,
+               allGrid / samples, allKernel / samples, hits, same ? "same" : "DIFFERENT");
+    }
+    // NARROWPHASE: the batch kernels against each other, first hit of the
+    // player against every cone and of every car against the others
+    const CollisionKernelType best = CollisionKernel::getType();
+    const bool avx2 = CollisionKernel::setType(COLLISION_AVX2);
+    const CollisionKernelType wide = avx2 ? COLLISION_AVX2 : COLLISION_SCALAR;
+    printf("\n%-8s %12s %12s %14s %14s  %s\n", "entities", "cones sc us", "cones avx2",
+           "all cars sc", "all cars avx2", "first hits");
+    for(int count : COUNTS) {
+        Random rng(4);
+        TrafficStore traffic;
+        LaneIndex lanes;
+        populate(traffic, count, rng);
+        PlayerCar player(PLAYER_START_X, PLAYER_START_Y, PLAYER_CAR);
+
+        double scalar = 0, vec = 0, allScalar = 0, allVec = 0;
+        bool same = true;
+        vector<int> scalarFirst(count), vecFirst(count);
+        for(int t = 0; t < ticks; t++) {
+            advance(traffic, lanes, rng);
+            player.move(t / 20 % 2 ? LEFT_ARROW : RIGHT_ARROW);
+            point loc = player.getLoc();
+
+            Clock::time_point start = Clock::now();
+            CollisionKernel::setType(COLLISION_SCALAR);
+            int scalarHit = CollisionKernel::firstBoxHit(loc.x, loc.y, player.getSize(),
+                                                         traffic.getConeLefts(), traffic.getConeTops(),
+                                                         traffic.getConeRights(), traffic.getConeBottoms(),
+                                                         traffic.getConeCount());
+            Clock::time_point mid = Clock::now();
+            CollisionKernel::setType(wide);
+            int vecHit = CollisionKernel::firstBoxHit(loc.x, loc.y, player.getSize(),
+                                                      traffic.getConeLefts(), traffic.getConeTops(),
+                                                      traffic.getConeRights(), traffic.getConeBottoms(),
+                                                      traffic.getConeCount());
+            Clock::time_point end = Clock::now();
+            scalar += chrono::duration<double, micro>(mid - start).count();
+            vec += chrono::duration<double, micro>(end - mid).count();
+            same = same && scalarHit == vecHit && scalarHit == scanCones(loc, player.getSize(), traffic);
+
+            if(t % 50 != 0) continue;
+            start = Clock::now();
+            CollisionKernel::setType(COLLISION_SCALAR);
+            kernelAllCars(traffic, scalarFirst);
+            mid = Clock::now();
+            CollisionKernel::setType(wide);
+            kernelAllCars(traffic, vecFirst);
+            end = Clock::now();
+            allScalar += chrono::duration<double, micro>(mid - start).count();
+            allVec += chrono::duration<double, micro>(end - mid).count();
+            same = same && scalarFirst == vecFirst;
+        }
+        CollisionKernel::setType(best);
+        identical = identical && same;
+
+        int samples = (ticks + 49) / 50;
+        printf("%-8d %12.2f %12.2f %14.1f %14.1f  %s%s\n", count, scalar / ticks, vec / ticks,
+               allScalar / samples, allVec / samples, same ? "same" : "DIFFERENT",
+               avx2 ? "" : " (no avx2)");
+    }
+    // LANE LOOKUPS: one AI decision asks four times; three decisions a tick
+    const int QUERIES = 3 * 4;
+    printf("\n%-8s %12s %12s %12s  %s\n", "cones", "linear us", "build us", "index us", "blocked");
+    for(int count : COUNTS) {
+        Random rng(2);
+        TrafficStore traffic;
+        populate(traffic, count, rng);
+        LaneIndex lanes;
+
+        double linear = 0, build = 0, index = 0;
+        long long blocked = 0;
+        bool same = true;
+        for(int t = 0; t < ticks; t++) {
+            advance(traffic, lanes, rng);
+            int y[QUERIES];
+            for(int q = 0; q < QUERIES; q++) y[q] = GRID_TOP + rng.nextInt(COL - GRID_TOP);
+
+            bool lin[QUERIES], idx[QUERIES];
+            Clock::time_point start = Clock::now();
+            for(int q = 0; q < QUERIES; q++) lin[q] = linearBlocked(LANE_X[q % 3], y[q], traffic);
+            Clock::time_point mid = Clock::now();
+            lanes.build(traffic);
+            Clock::time_point built = Clock::now();
+            for(int q = 0; q < QUERIES; q++) idx[q] = lanes.blockedAhead(static_cast<AILane>(q % 3), y[q], AI_LANE_LOOKAHEAD);
+            Clock::time_point end = Clock::now();
+
+            linear += chrono::duration<double, micro>(mid - start).count();
+            build += chrono::duration<double, micro>(built - mid).count();
+            index += chrono::duration<double, micro>(end - built).count();
+            for(int q = 0; q < QUERIES; q++) {
+                same = same && lin[q] == idx[q];
+                blocked += lin[q];
+            }
+        }
+        identical = identical && same;
+
+        printf("%-8d %12.2f %12.2f %12.2f  %lld %s\n", count, linear / ticks, build / ticks,
+               index / ticks, blocked, same ? "same" : "DIFFERENT");
+    }
+    // STEP SIZE: cones fall past a steering player on straight paths,
+    // sampled every `step` ticks. The path as a whole decides a real hit.
+    const int STEPS[] = { 1, 2, 4, 8, 16 };
+    const int PASSES = 20000;
+    const int PASS_TICKS = 64;
+    printf("\n%-8s %12s %12s %12s  %s\n", "step", "real hits", "end-of-step", "swept", "ticks/pass");
+    for(int step : STEPS) {
+        Random rng(3);
+        long long real = 0, ended = 0, swept = 0;
+        for(int p = 0; p < PASSES; p++) {
+            // Random phase, so no sample lands on the player by design
+            point cone0(ROAD_START + rng.nextInt(ROAD_WIDTH),
+                        PLAYER_START_Y - MAX_SPEED * PASS_TICKS / 2 - rng.nextInt(MAX_SPEED * 16));
+            point car0(ROAD_START + rng.nextInt(ROAD_WIDTH), PLAYER_START_Y);
+            int steer = rng.nextInt(9) - 4;
+            point coneEnd(cone0.x, cone0.y + MAX_SPEED * PASS_TICKS);
+            point carEnd(car0.x + steer * PASS_TICKS, car0.y);
+
+            float toi;
+            real += Collision::sweepBoxes(car0, carEnd, SIZE / 2, cone0, coneEnd, OBSTACLE_SIZE / 2, toi);
+
+            bool endHit = false, sweptHit = false;
+            point conePrv = cone0, carPrv = car0;
+            for(int t = step; t <= PASS_TICKS; t += step) {
+                point cone(cone0.x, cone0.y + MAX_SPEED * t);
+                point car(car0.x + steer * t, car0.y);
+                endHit = endHit || (abs(car.x - cone.x) < SIZE / 2 + OBSTACLE_SIZE / 2 &&
+                                    abs(car.y - cone.y) < SIZE / 2 + OBSTACLE_SIZE / 2);
+                sweptHit = sweptHit || Collision::sweepBoxes(carPrv, car, SIZE / 2, conePrv, cone,
+                                                            OBSTACLE_SIZE / 2, toi);
+                conePrv = cone;
+                carPrv = car;
+            }
+            ended += endHit;
+            swept += sweptHit;
+        }
+        identical = identical && swept >= ended;
+
+        printf("%-8d %12lld %12lld %12lld  %d\n", step, real, ended, swept, PASS_TICKS / step);
+    }
+    return identical ? 0 : 2;
+}
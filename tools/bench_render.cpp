@@ -0,0 +1,333 @@
+//================================================================
+// bench_render.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Render Benchmark
+// Description: Times each drawing layer into a headless plotter,
+//              next to the old one-plotPixel-per-pixel loops and
+//              stroke-by-stroke text, and
+//              each fill kernel, checking they all produce the same
+//              pixels, times race frames split across band threads
+//              and reports texture bytes uploaded per frame
+//
+// Build (from repo root):
+//   g++ -std=c++17 -O2 -I. tools/bench_render.cpp Game.cpp
+//       TrafficStore.cpp CollisionKernel.cpp SpatialGrid.cpp LaneIndex.cpp
+//       Car.cpp Obstacle.cpp Sprite.cpp DrawList.cpp Background.cpp Points.cpp
+//       Screen.cpp Font.cpp BandRenderer.cpp SDL_Plotter.cpp -lSDL2 -lSDL2_mixer
+//       -pthread
+//================================================================
+
+#include "BandRenderer.h"
+#include "Game.h"
+#include "Utils.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cctype>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+// PER-PIXEL REFERENCE (the drawing code before span fills)
+
+static void perPixelRect(int x, int y, int width, int height, color c, SDL_Plotter& g) {
+    for(int row = y; row < y + height; row++) {
+        for(int col = x; col < x + width; col++) {
+            if(col >= 0 && col < 600 && row >= 0 && row < 600) {
+                g.plotPixel(col, row, c);
+            }
+        }
+    }
+}
+
+static void perPixelScreen(color c, SDL_Plotter& g) {
+    for(int x = 0; x < ROW; x++) {
+        for(int y = 0; y < COL; y++) {
+            g.plotPixel(x, y, c);
+        }
+    }
+}
+
+static void perPixelBackground(int offset, SDL_Plotter& g) {
+    for(int y = 0; y < COL; y++) {
+        for(int x = 0; x < ROW; x++) g.plotPixel(x, y, GRASS);
+    }
+    for(int y = 0; y < COL; y++) {
+        for(int x = ROAD_START; x < ROAD_END; x++) g.plotPixel(x, y, ROAD);
+    }
+    for(int y = 0; y < COL; y++) {
+        int adjustedY = (y + offset) % (DASH_LENGTH + GAP_LENGTH);
+        if(adjustedY < DASH_LENGTH) {
+            for(int i = -LANE_MARKER_WIDTH; i <= LANE_MARKER_WIDTH; i++) {
+                g.plotPixel(CENTER_LANE_X + i, y, ROAD_LINE);
+            }
+            for(int i = -1; i <= 1; i++) {
+                g.plotPixel(ROAD_START + SIDE_LANE_OFFSET + i, y, WHITE2);
+                g.plotPixel(ROAD_END - SIDE_LANE_OFFSET + i, y, WHITE2);
+            }
+        }
+    }
+    for(int y = 0; y < COL; y++) {
+        for(int i = -LANE_MARKER_WIDTH; i <= LANE_MARKER_WIDTH; i++) {
+            g.plotPixel(ROAD_START + i, y, WHITE2);
+            g.plotPixel(ROAD_END + i, y, WHITE2);
+        }
+    }
+}
+
+// Car::draw before sprites: body, then four wheels over it
+static void perPixelCar(int x, int y, color c, SDL_Plotter& g) {
+    int wheelSize = SIZE / 5 + 2;
+    perPixelRect(x - SIZE / 2, y - SIZE / 2, SIZE, SIZE, c, g);
+    perPixelRect(x - SIZE / 2, y - SIZE / 2, wheelSize, wheelSize, BLACK, g);
+    perPixelRect(x + SIZE / 2 - wheelSize, y - SIZE / 2, wheelSize, wheelSize, BLACK, g);
+    perPixelRect(x - SIZE / 2, y + SIZE / 2 - wheelSize, wheelSize, wheelSize, BLACK, g);
+    perPixelRect(x + SIZE / 2 - wheelSize, y + SIZE / 2 - wheelSize, wheelSize, wheelSize, BLACK, g);
+}
+
+// Cone drawing before sprites: cone shape and bounds worked out per pixel
+static void perPixelCone(int cx, int cy, SDL_Plotter& g) {
+    const int size = OBSTACLE_SIZE;
+    for(int y = 0; y < size; y++) {
+        int width = (y * size) / size;
+        for(int x = -width / 2; x <= width / 2; x++) {
+            int drawX = cx + x;
+            int drawY = cy - size / 2 + y;
+            if(drawX >= 0 && drawX < ROW && drawY >= 0 && drawY < COL) {
+                g.plotPixel(drawX, drawY, y / OBSTACLE_STRIPE_HEIGHT % 2 == 0 ? ORANGE : WHITE2);
+            }
+        }
+    }
+}
+
+// Text as drawn before the glyph atlas, one glyph's strokes at a time
+static void strokeText(int x, int y, color c, const string& text, bool large, SDL_Plotter& g) {
+    const int cell = large ? 30 : 15;
+    for(size_t i = 0; i < text.size(); i++) {
+        char ch = toupper(text[i]);
+        if(ch == ' ') { x += large ? cell / 8 : cell / 2; continue; }
+        if(large) FontRenderer::strokeLarge(g, x + i * cell, y, c, ch);
+        else FontRenderer::strokeSmall(g, x + i * cell, y, c, ch);
+    }
+}
+
+/*
+ * Description: Average time of one call of draw, after a warm-up call
+ * Return: double - microseconds per call
+ * Pre-condition: iterations > 0
+ * Post-condition: g holds the last drawn frame
+ */
+static double timeDraw(const function<void()>& draw, int iterations) {
+    typedef chrono::steady_clock Clock;
+    draw();
+    Clock::time_point start = Clock::now();
+    for(int i = 0; i < iterations; i++) draw();
+    return chrono::duration<double, micro>(Clock::now() - start).count() / iterations;
+}
+
+int main(int argc, char** argv) {
+    int iterations = 200;
+    for(int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if(arg == "--iterations" && i + 1 < argc) iterations = max(1, atoi(argv[++i]));
+        else {
+            cerr << "usage: " << argv[0] << " [--iterations N]" << endl;
+            return 1;
+        }
+    }
+
+    SDL_Plotter g(ROW, COL, false, PLOTTER_HEADLESS);
+    vector<Uint32> reference(ROW * COL);
+
+    // A race a little way in, so the dashes are scrolled
+    Game game(1);
+    game.handleInput('S');
+    for(int t = 0; t < 40; t++) game.tick();
+    Background bg;
+    for(int t = 0; t < 7; t++) bg.update(CAR_START_SPEED);
+    StartScreen start;
+
+    // A crowded road: cars of every color and cones, some off the edges
+    const color carColors[] = { PLAYER_CAR, AI_BLUE, AI_GREEN, AI_YELLOW };
+    vector<PlayerCar> cars;
+    TrafficStore cones;
+    for(int i = 0; i < 200; i++) {
+        cars.push_back(PlayerCar(i * 37 % (ROW + 40) - 20, i * 23 % (COL + 40) - 20, carColors[i % 4]));
+        cones.addCone(i * 53 % (ROW + 40) - 20, i * 29 % (COL + 40) - 20, OBSTACLE_SIZE);
+    }
+
+    // Every string of the instructions screen plus the HUD
+    const vector<string> lines = {
+        "UP: Accelerate", "DOWN: Brake", "LEFT/RIGHT: Steer", "Pass cars = 10pts",
+        "Obstacles = CRASH", "Press S to START", "Press B to go BACK",
+        "Score: 1234567", "Speed: 15", "Final Score: 0123456789"
+    };
+
+    struct Layer {
+        const char*     name;
+        function<void()> perPixel;
+        function<void()> span;
+    };
+    DrawList list;
+    vector<Layer> layers = {
+        { "screen fill",
+          [&]() { perPixelScreen(BG_START, g); },
+          [&]() { g.fillRows(0, COL, BG_START); } },
+        { "background",
+          [&]() { perPixelBackground(bg.getOffset(), g); },
+          [&]() { list.clear(); bg.draw(list); list.execute(g); } },
+        { "car rects x100",
+          [&]() { for(int i = 0; i < 100; i++) perPixelRect(i * 6 - 20, i * 5, SIZE, SIZE, AI_BLUE, g); },
+          [&]() { for(int i = 0; i < 100; i++) drawRect(i * 6 - 20, i * 5, SIZE, SIZE, AI_BLUE, g); } },
+        { "entities x400",
+          [&]() {
+              // Cones under cars, as the draw list layers them
+              for(int i = 0; i < 200; i++) perPixelCone(cones.getConeLoc(i).x, cones.getConeLoc(i).y, g);
+              for(int i = 0; i < 200; i++) perPixelCar(cars[i].getLoc().x, cars[i].getLoc().y, carColors[i % 4], g);
+          },
+          [&]() {
+              list.clear();
+              for(int i = 0; i < 200; i++) cars[i].draw(list);
+              cones.draw(list);
+              list.execute(g);
+          } },
+        { "text",
+          [&]() {
+              strokeText(30, 40, CYAN, "CONTROLS", true, g);
+              strokeText(110, 220, YELLOW, "PIXEL RACERS", true, g);
+              for(size_t i = 0; i < lines.size(); i++) strokeText(30, 90 + 40 * i, WHITE2, lines[i], false, g);
+          },
+          [&]() {
+              FontRenderer::drawLarge(g, 30, 40, CYAN, "CONTROLS");
+              FontRenderer::drawLarge(g, 110, 220, YELLOW, "PIXEL RACERS");
+              for(size_t i = 0; i < lines.size(); i++) FontRenderer::drawSmall(g, 30, 90 + 40 * i, WHITE2, lines[i]);
+          } },
+    };
+
+    printf("=== PIXEL RACERS RENDER: %dx%d, %d iterations ===\n", ROW, COL, iterations);
+    printf("%-16s %12s %12s %9s  %s\n", "layer", "per-pixel us", "span us", "speedup", "pixels");
+    bool identical = true;
+    for(const Layer& layer : layers) {
+        g.clear();
+        double before = timeDraw(layer.perPixel, iterations);
+        memcpy(reference.data(), g.getPixels(), reference.size() * sizeof(Uint32));
+
+        g.clear();
+        double after = timeDraw(layer.span, iterations);
+        bool same = memcmp(reference.data(), g.getPixels(), reference.size() * sizeof(Uint32)) == 0;
+        identical = identical && same;
+
+        printf("%-16s %12.1f %12.1f %8.1fx  %s\n", layer.name, before, after,
+               after > 0 ? before / after : 0.0, same ? "same" : "DIFFERENT");
+    }
+
+    // FILL KERNELS: clear-then-repaint against a single clear to color
+    static const char* KERNEL_NAMES[] = { "scalar", "sse2", "avx2" };
+    FillKernelType best = SDL_Plotter::getFillKernel();
+    g.clear();
+    game.draw(g);
+    memcpy(reference.data(), g.getPixels(), reference.size() * sizeof(Uint32));
+
+    printf("\n%-16s %12s %12s %12s  %s\n", "fill kernel", "clear+fill us", "clear(c) us", "frame us", "pixels");
+    for(int k = FILL_SCALAR; k <= FILL_AVX2; k++) {
+        if(!SDL_Plotter::setFillKernel(static_cast<FillKernelType>(k))) {
+            printf("%-16s %12s\n", KERNEL_NAMES[k], "unsupported");
+            continue;
+        }
+        double twoPass = timeDraw([&]() { g.clear(); g.fillRows(0, COL, BG_START); }, iterations);
+        double onePass = timeDraw([&]() { g.clear(BG_START); }, iterations);
+        double frame = timeDraw([&]() { game.draw(g); }, iterations);
+        bool same = memcmp(reference.data(), g.getPixels(), reference.size() * sizeof(Uint32)) == 0;
+        identical = identical && same;
+
+        printf("%-16s %12.1f %12.1f %12.1f  %s%s\n", KERNEL_NAMES[k], twoPass, onePass, frame,
+               same ? "same" : "DIFFERENT", k == best ? "  (default)" : "");
+    }
+    SDL_Plotter::setFillKernel(best);
+
+    // Whole frames as the game draws them now
+    double playing = timeDraw([&]() { game.draw(g); }, iterations);
+    double menu = timeDraw([&]() { start.draw(g); }, iterations);
+    double idle = timeDraw([&]() { g.setIncremental(true); start.draw(g); }, iterations);
+    g.setIncremental(false);
+    printf("\nframe (playing)  %12.1f us\n", playing);
+    printf("frame (start)    %12.1f us\n", menu);
+    printf("frame (idle)     %12.1f us\n", idle);
+
+    // DRAW LIST: recording against replaying, and what a band culls
+    double record = timeDraw([&]() { game.recordRace(); }, iterations);
+    const DrawList& race = game.recordRace();
+    double replay = timeDraw([&]() { race.execute(g); }, iterations);
+    SDL_Plotter band(g, 0, COL / 4);
+    int inBand = race.execute(band);
+    printf("\ndraw list record %12.1f us  (%d commands)\n", record, race.size());
+    printf("draw list replay %12.1f us  (%d drawn into the top quarter band)\n", replay, inBand);
+
+    // BANDS: the same race frame drawn by 1, 2, 4, ... threads
+    game.draw(g);
+    memcpy(reference.data(), g.getPixels(), reference.size() * sizeof(Uint32));
+    int cores = max(1, (int)thread::hardware_concurrency());
+    printf("\n%-16s %12s %9s  %s   (%d hardware threads)\n", "band threads", "frame us", "speedup", "pixels", cores);
+    double oneBand = 0;
+    for(int threads = 1; threads <= max(cores, 2); threads *= 2) {
+        BandRenderer bands(threads);
+        double frame = timeDraw([&]() {
+            const DrawList& frame = game.recordRace();
+            bands.render(g, [&frame](SDL_Plotter& band) { frame.execute(band); });
+        }, iterations);
+        if(threads == 1) oneBand = frame;
+        bool same = memcmp(reference.data(), g.getPixels(), reference.size() * sizeof(Uint32)) == 0;
+        identical = identical && same;
+        printf("%-16d %12.1f %8.1fx  %s\n", threads, frame, frame > 0 ? oneBand / frame : 0.0,
+               same ? "same" : "DIFFERENT");
+    }
+
+    // UPLOAD: damaged bytes per frame, and incremental menu frames must
+    // end up with the same pixels as full redraws
+    SDL_Plotter full(ROW, COL, false, PLOTTER_HEADLESS);
+    const int menuFrames = 120;
+    size_t fullBytes = 0, incrementalBytes = 0;
+    bool incrementalSame = true;
+
+    game.draw(g);
+    g.update();
+    size_t playingBytes = 0;
+    for(int i = 0; i < menuFrames; i++) {
+        game.tick();
+        game.draw(g);
+        g.update();
+        playingBytes += g.getBytesUploaded();
+    }
+
+    StartScreen flashing;
+    flashing.draw(g);
+    g.update();
+    for(int i = 0; i < menuFrames; i++) {
+        flashing.update();
+        full.setIncremental(false);
+        flashing.draw(full);
+        full.update();
+        fullBytes += full.getBytesUploaded();
+
+        g.setIncremental(true);
+        flashing.draw(g);
+        g.update();
+        incrementalBytes += g.getBytesUploaded();
+        incrementalSame = incrementalSame &&
+            memcmp(full.getPixels(), g.getPixels(), ROW * COL * sizeof(Uint32)) == 0;
+    }
+    g.setIncremental(false);
+    identical = identical && incrementalSame;
+
+    printf("\nuploaded (playing)            %9zu bytes/frame\n", playingBytes / menuFrames);
+    printf("uploaded (start, full)        %9zu bytes/frame\n", fullBytes / menuFrames);
+    printf("uploaded (start, incremental) %9zu bytes/frame  %s\n", incrementalBytes / menuFrames,
+           incrementalSame ? "same" : "DIFFERENT");
+
+    return identical ? 0 : 2;
+}